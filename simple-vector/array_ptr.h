@@ -3,6 +3,9 @@
 #include <cassert>
 #include <cstdlib>
 #include <algorithm>
+#include <memory_resource>
+#include <new>
+#include <utility>
 
 template <typename Type>
 class ArrayPtr {
@@ -84,3 +87,129 @@ public:
 private:
     Type* raw_ptr_ = nullptr;
 };
+
+// Владеет "сырым" блоком памяти под capacity элементов типа Type,
+// не конструируя сами элементы. В отличие от ArrayPtr здесь не вызываются
+// ни конструкторы, ни деструкторы элементов — за время жизни элементов
+// отвечает владелец (SimpleVector создаёт их placement new и разрушает явно).
+// Память берётся у переданного memory_resource (по умолчанию — глобальная куча),
+// ресурс переезжает вместе с блоком при перемещении и swap
+template <typename Type>
+class RawArrayPtr {
+public:
+    // Инициализирует RawArrayPtr нулевым указателем
+    RawArrayPtr() = default;
+
+    // Выделяет в куче неинициализированную память под capacity элементов типа Type.
+    // Если capacity == 0, поле raw_ptr_ должно быть равно nullptr
+    explicit RawArrayPtr(size_t capacity)
+        : RawArrayPtr(capacity, std::pmr::get_default_resource()) {
+    }
+
+    // Выделяет память под capacity элементов у ресурса resource
+    RawArrayPtr(size_t capacity, std::pmr::memory_resource* resource)
+        : resource_(resource) {
+        assert(resource != nullptr);
+        if (capacity != 0) {
+            raw_ptr_ = Allocate(capacity);
+            capacity_ = capacity;
+        }
+    }
+
+    // Принимает во владение внешний блок из capacity элементов.
+    // Блок должен быть выделен у resource ровно как capacity * sizeof(Type)
+    // байт с выравниванием alignof(Type) — именно так он будет освобождён
+    RawArrayPtr(Type* raw_ptr, size_t capacity, std::pmr::memory_resource* resource) noexcept
+        : raw_ptr_(raw_ptr), capacity_(capacity), resource_(resource) {
+        assert(resource != nullptr);
+    }
+
+    RawArrayPtr(RawArrayPtr&& other) noexcept {
+        raw_ptr_ = std::exchange(other.raw_ptr_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+        resource_ = other.resource_;
+    }
+
+    RawArrayPtr& operator=(RawArrayPtr&& rhs) noexcept {
+        if (this == &rhs) {
+            return *this;
+        }
+        Deallocate();
+        raw_ptr_ = std::exchange(rhs.raw_ptr_, nullptr);
+        capacity_ = std::exchange(rhs.capacity_, 0);
+        resource_ = rhs.resource_;
+
+        return *this;
+    }
+
+    // Запрещаем копирование
+    RawArrayPtr(const RawArrayPtr&) = delete;
+
+    // Запрещаем присваивание
+    RawArrayPtr& operator=(const RawArrayPtr&) = delete;
+
+    ~RawArrayPtr() {
+        Deallocate();
+    }
+
+    // Прекращает владением памятью, возвращает значение адреса блока.
+    // После вызова метода указатель на блок должен обнулиться
+    [[nodiscard]] Type* Release() noexcept {
+        capacity_ = 0;
+        return std::exchange(raw_ptr_, nullptr);
+    }
+
+    // Возвращает ссылку на элемент массива с индексом index.
+    // Обращаться можно только к уже сконструированным элементам
+    Type& operator[](size_t index) noexcept {
+        return raw_ptr_[index];
+    }
+
+    // Возвращает константную ссылку на элемент массива с индексом index
+    const Type& operator[](size_t index) const noexcept {
+        return raw_ptr_[index];
+    }
+
+    // Возвращает true, если указатель ненулевой, и false в противном случае
+    explicit operator bool() const {
+        return raw_ptr_ != nullptr;
+    }
+
+    // Возвращает значение сырого указателя, хранящего адрес начала блока
+    Type* Get() const noexcept {
+        return raw_ptr_;
+    }
+
+    // Возвращает вместимость блока в элементах
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    // Возвращает ресурс памяти, которому принадлежит блок
+    std::pmr::memory_resource* GetMemoryResource() const noexcept {
+        return resource_;
+    }
+
+    // Обменивается значениями с объектом other
+    void swap(RawArrayPtr& other) noexcept {
+        std::swap(raw_ptr_, other.raw_ptr_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(resource_, other.resource_);
+    }
+
+private:
+    Type* Allocate(size_t capacity) {
+        return static_cast<Type*>(
+            resource_->allocate(capacity * sizeof(Type), alignof(Type)));
+    }
+
+    void Deallocate() noexcept {
+        if (raw_ptr_ != nullptr) {
+            resource_->deallocate(raw_ptr_, capacity_ * sizeof(Type), alignof(Type));
+        }
+    }
+
+    Type* raw_ptr_ = nullptr;
+    size_t capacity_ = 0;
+    std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+};
@@ -0,0 +1,291 @@
+// Бенчмарк SimpleVector против std::vector по горячим операциям.
+// Сборка: g++ -std=c++17 -O2 -DNDEBUG benchmark.cpp -o benchmark
+// Для каждой операции печатается среднее время на операцию в наносекундах
+// и число байт, выделенных через глобальный operator new
+
+#include "simple_vector.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+// Счётчик байт, прошедших через глобальный new — общий для обоих контейнеров
+size_t g_allocated_bytes = 0;
+
+}  // namespace
+
+void* operator new(size_t size) {
+    g_allocated_bytes += size;
+    if (void* ptr = malloc(size)) {
+        return ptr;
+    }
+    throw bad_alloc{};
+}
+
+void* operator new(size_t size, align_val_t align) {
+    g_allocated_bytes += size;
+    if (void* ptr = aligned_alloc(static_cast<size_t>(align), size)) {
+        return ptr;
+    }
+    throw bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, align_val_t) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t, align_val_t) noexcept {
+    free(ptr);
+}
+
+namespace {
+
+// Перемещаемый, но не копируемый тип — как X из main.cpp
+class MoveOnly {
+public:
+    MoveOnly()
+        : MoveOnly(5) {
+    }
+    MoveOnly(size_t num)
+        : x_(num) {
+    }
+    MoveOnly(const MoveOnly&) = delete;
+    MoveOnly& operator=(const MoveOnly&) = delete;
+    MoveOnly(MoveOnly&& other) {
+        x_ = exchange(other.x_, 0);
+    }
+    MoveOnly& operator=(MoveOnly&& other) {
+        x_ = exchange(other.x_, 0);
+        return *this;
+    }
+    size_t GetX() const {
+        return x_;
+    }
+
+private:
+    size_t x_;
+};
+
+// Значение элемента с номером i для каждого типа полезной нагрузки
+int64_t MakeValue(int64_t*, size_t i) {
+    return static_cast<int64_t>(i);
+}
+
+string MakeValue(string*, size_t i) {
+    return "payload-"s + to_string(i);
+}
+
+MoveOnly MakeValue(MoveOnly*, size_t i) {
+    return MoveOnly(i);
+}
+
+// Запускает body() и печатает строку отчёта: среднее время на операцию
+// (total_ops операций за все повторы) и выделенные байты
+template <typename Body>
+void RunCase(const string& name, size_t total_ops, Body body) {
+    g_allocated_bytes = 0;
+    auto start = chrono::steady_clock::now();
+    body();
+    auto finish = chrono::steady_clock::now();
+    auto ns = chrono::duration_cast<chrono::nanoseconds>(finish - start).count();
+    cout << left << setw(44) << name
+         << right << setw(10) << ns / static_cast<int64_t>(total_ops) << " ns/op"
+         << setw(14) << g_allocated_bytes << " bytes" << endl;
+}
+
+template <typename Container, typename Payload>
+void BenchPushBackGrowth(const string& name, size_t count, size_t repeats) {
+    RunCase(name, count * repeats, [&] {
+        for (size_t r = 0; r < repeats; ++r) {
+            Container v;
+            for (size_t i = 0; i < count; ++i) {
+                v.push_back(MakeValue(static_cast<Payload*>(nullptr), i));
+            }
+        }
+    });
+}
+
+// SimpleVector не использует STL-имена методов, поэтому отдельная версия
+template <typename Payload>
+void BenchSimplePushBackGrowth(const string& name, size_t count, size_t repeats) {
+    RunCase(name, count * repeats, [&] {
+        for (size_t r = 0; r < repeats; ++r) {
+            SimpleVector<Payload> v;
+            for (size_t i = 0; i < count; ++i) {
+                v.PushBack(MakeValue(static_cast<Payload*>(nullptr), i));
+            }
+        }
+    });
+}
+
+template <typename Payload>
+void BenchReserveFill(size_t count, size_t repeats) {
+    RunCase("SimpleVector<"s + typeid(Payload).name() + "> reserve+fill"s, count * repeats, [&] {
+        for (size_t r = 0; r < repeats; ++r) {
+            SimpleVector<Payload> v;
+            v.Reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                v.PushBack(MakeValue(static_cast<Payload*>(nullptr), i));
+            }
+        }
+    });
+    RunCase("std::vector<"s + typeid(Payload).name() + "> reserve+fill"s, count * repeats, [&] {
+        for (size_t r = 0; r < repeats; ++r) {
+            vector<Payload> v;
+            v.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                v.push_back(MakeValue(static_cast<Payload*>(nullptr), i));
+            }
+        }
+    });
+}
+
+void BenchInsertFrontMiddle(size_t count) {
+    RunCase("SimpleVector<int64_t> insert front"s, count, [&] {
+        SimpleVector<int64_t> v;
+        for (size_t i = 0; i < count; ++i) {
+            v.Insert(v.begin(), static_cast<int64_t>(i));
+        }
+    });
+    RunCase("std::vector<int64_t> insert front"s, count, [&] {
+        vector<int64_t> v;
+        for (size_t i = 0; i < count; ++i) {
+            v.insert(v.begin(), static_cast<int64_t>(i));
+        }
+    });
+    RunCase("SimpleVector<int64_t> insert middle"s, count, [&] {
+        SimpleVector<int64_t> v;
+        for (size_t i = 0; i < count; ++i) {
+            v.Insert(v.begin() + v.GetSize() / 2, static_cast<int64_t>(i));
+        }
+    });
+    RunCase("std::vector<int64_t> insert middle"s, count, [&] {
+        vector<int64_t> v;
+        for (size_t i = 0; i < count; ++i) {
+            v.insert(v.begin() + static_cast<ptrdiff_t>(v.size() / 2),
+                     static_cast<int64_t>(i));
+        }
+    });
+}
+
+void BenchEraseSweep(size_t count) {
+    RunCase("SimpleVector<int64_t> erase front sweep"s, count, [&] {
+        SimpleVector<int64_t> v(count, 42);
+        while (!v.IsEmpty()) {
+            v.Erase(v.begin());
+        }
+    });
+    RunCase("std::vector<int64_t> erase front sweep"s, count, [&] {
+        vector<int64_t> v(count, 42);
+        while (!v.empty()) {
+            v.erase(v.begin());
+        }
+    });
+}
+
+void BenchResize(size_t count, size_t repeats) {
+    RunCase("SimpleVector<int64_t> resize up/down"s, repeats * 2, [&] {
+        SimpleVector<int64_t> v;
+        for (size_t r = 0; r < repeats; ++r) {
+            v.Resize(count);
+            v.Resize(count / 2);
+        }
+    });
+    RunCase("std::vector<int64_t> resize up/down"s, repeats * 2, [&] {
+        vector<int64_t> v;
+        for (size_t r = 0; r < repeats; ++r) {
+            v.resize(count);
+            v.resize(count / 2);
+        }
+    });
+}
+
+void BenchCopyMoveAssign(size_t count, size_t repeats) {
+    SimpleVector<string> simple_src(count, "some moderately long payload string"s);
+    vector<string> std_src(count, "some moderately long payload string"s);
+
+    RunCase("SimpleVector<string> copy assign"s, repeats, [&] {
+        SimpleVector<string> dst;
+        for (size_t r = 0; r < repeats; ++r) {
+            dst = simple_src;
+        }
+    });
+    RunCase("std::vector<string> copy assign"s, repeats, [&] {
+        vector<string> dst;
+        for (size_t r = 0; r < repeats; ++r) {
+            dst = std_src;
+        }
+    });
+    RunCase("SimpleVector<string> move assign cycle"s, repeats, [&] {
+        SimpleVector<string> a(simple_src);
+        SimpleVector<string> b;
+        for (size_t r = 0; r < repeats; ++r) {
+            b.swap(a);
+            a.swap(b);
+        }
+    });
+    RunCase("std::vector<string> move assign cycle"s, repeats, [&] {
+        vector<string> a(std_src);
+        vector<string> b;
+        for (size_t r = 0; r < repeats; ++r) {
+            b = move(a);
+            a = move(b);
+        }
+    });
+}
+
+void BenchMoveOnlyPushBack(size_t count, size_t repeats) {
+    BenchSimplePushBackGrowth<MoveOnly>("SimpleVector<MoveOnly> push back growth"s,
+                                        count, repeats);
+    BenchPushBackGrowth<vector<MoveOnly>, MoveOnly>("std::vector<MoveOnly> push back growth"s,
+                                                    count, repeats);
+}
+
+}  // namespace
+
+int main() {
+    const size_t large = 1000000;
+    const size_t medium = 100000;
+    const size_t small = 30000;
+
+    cout << "--- PushBack growth from empty ---"s << endl;
+    BenchSimplePushBackGrowth<int64_t>("SimpleVector<int64_t> push back growth"s, large, 5);
+    BenchPushBackGrowth<vector<int64_t>, int64_t>("std::vector<int64_t> push back growth"s, large, 5);
+    BenchSimplePushBackGrowth<string>("SimpleVector<string> push back growth"s, medium, 5);
+    BenchPushBackGrowth<vector<string>, string>("std::vector<string> push back growth"s, medium, 5);
+    BenchMoveOnlyPushBack(large, 5);
+
+    cout << "--- Reserve + fill ---"s << endl;
+    BenchReserveFill<int64_t>(large, 5);
+
+    cout << "--- Insert at front/middle ---"s << endl;
+    BenchInsertFrontMiddle(small);
+
+    cout << "--- Erase sweep ---"s << endl;
+    BenchEraseSweep(small);
+
+    cout << "--- Resize up/down ---"s << endl;
+    BenchResize(large, 100);
+
+    cout << "--- Copy/move assignment ---"s << endl;
+    BenchCopyMoveAssign(medium, 20);
+
+    return 0;
+}
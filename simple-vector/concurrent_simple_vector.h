@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cassert>
+#include <iterator>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "simple_vector.h"
+
+// Конкурентная воронка для многопоточной записи: producer-потоки добавляют
+// элементы, один consumer забирает всё разом через Consolidate.
+// Вместо одного вектора за общим мьютексом элементы складываются в шарды —
+// шард выбирается по хэшу идентификатора потока, поэтому в типичном случае
+// каждый producer пишет в свой шард и его мьютекс никем не оспаривается.
+// Порядок элементов между потоками не сохраняется (внутри потока — сохраняется)
+template <typename Type>
+class ConcurrentSimpleVector {
+public:
+    // shard_count == 0 — число шардов выбирается по количеству ядер.
+    // Фактическое число округляется вверх до степени двойки
+    explicit ConcurrentSimpleVector(size_t shard_count = 0,
+                                    std::pmr::memory_resource* resource
+                                        = std::pmr::get_default_resource())
+        : resource_(resource) {
+        assert(resource != nullptr);
+        if (shard_count == 0) {
+            shard_count = std::thread::hardware_concurrency();
+        }
+        shard_mask_ = RoundUpToPowerOfTwo(shard_count) - 1;
+        shards_ = ArrayPtr<Shard>(shard_mask_ + 1);
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            SimpleVector<Type> storage(resource);
+            shards_[i].items.swap(storage);
+        }
+    }
+
+    // Шарды содержат мьютексы, объект привязан к месту создания
+    ConcurrentSimpleVector(const ConcurrentSimpleVector&) = delete;
+    ConcurrentSimpleVector& operator=(const ConcurrentSimpleVector&) = delete;
+
+    // Добавляет элемент в шард текущего потока
+    void PushBack(const Type& item) {
+        Shard& shard = ShardForThisThread();
+        std::lock_guard guard(shard.mutex);
+        shard.items.PushBack(item);
+    }
+
+    void PushBack(Type&& item) {
+        Shard& shard = ShardForThisThread();
+        std::lock_guard guard(shard.mutex);
+        shard.items.PushBack(std::move(item));
+    }
+
+    // Конструирует элемент из args в шарде текущего потока
+    template <typename... Args>
+    void EmplaceBack(Args&&... args) {
+        Shard& shard = ShardForThisThread();
+        std::lock_guard guard(shard.mutex);
+        shard.items.EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    // Возвращает суммарное число элементов во всех шардах.
+    // Значение мгновенно устаревает, если producer-потоки ещё пишут
+    size_t GetSize() const {
+        size_t total = 0;
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            std::lock_guard guard(shards_[i].mutex);
+            total += shards_[i].items.GetSize();
+        }
+        return total;
+    }
+
+    // Переносит содержимое всех шардов в один непрерывный SimpleVector
+    // за одно выделение памяти; шарды пустеют, но сохраняют вместимость.
+    // Элементы идут в порядке шардов, внутри шарда — в порядке добавления
+    SimpleVector<Type> Consolidate() {
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            shards_[i].mutex.lock();
+        }
+
+        size_t total = 0;
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            total += shards_[i].items.GetSize();
+        }
+
+        SimpleVector<Type> result(resource_);
+        result.Reserve(total);
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            auto& items = shards_[i].items;
+            result.AppendRange(std::make_move_iterator(items.begin()),
+                               std::make_move_iterator(items.end()));
+            items.Clear();
+        }
+
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            shards_[shard_mask_ - i].mutex.unlock();
+        }
+        return result;
+    }
+
+private:
+    // Шард выровнен на кэш-линию, чтобы записи соседних потоков
+    // не толкались на одной линии (false sharing)
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        SimpleVector<Type> items;
+    };
+
+    static size_t RoundUpToPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result *= 2;
+        }
+        return result;
+    }
+
+    // Номер шарда вычисляется из идентификатора потока один раз на поток
+    Shard& ShardForThisThread() const {
+        static thread_local size_t thread_slot
+            = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        return shards_.Get()[thread_slot & shard_mask_];
+    }
+
+    std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+    ArrayPtr<Shard> shards_;
+    size_t shard_mask_ = 0;
+};
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+#include "simple_vector.h"
+
+// Обёртка над SimpleVector с разделением буфера по счётчику ссылок
+// (copy-on-write). Копирование и SharedSnapshot выполняются за O(1):
+// читатели разделяют один буфер, пока кто-нибудь не попытается писать —
+// первый мутирующий вызов делает глубокую копию (в этот момент и только
+// в этот момент происходит копирование 2ГБ, а не на каждый снимок).
+//
+// Константные операции читают общий буфер; снимки можно читать из любых
+// потоков. Мутировать один и тот же CowSimpleVector из нескольких потоков
+// одновременно нельзя — проверка уникальности не атомарна относительно записи
+template <typename Type>
+class CowSimpleVector {
+public:
+    using ConstIterator = typename SimpleVector<Type>::ConstIterator;
+
+    CowSimpleVector()
+        : data_(std::make_shared<SimpleVector<Type>>()) {
+    }
+
+    // Создаёт вектор из size элементов со значением по умолчанию
+    explicit CowSimpleVector(size_t size)
+        : data_(std::make_shared<SimpleVector<Type>>(size)) {
+    }
+
+    // Создаёт вектор из size элементов со значением value
+    CowSimpleVector(size_t size, const Type& value)
+        : data_(std::make_shared<SimpleVector<Type>>(size, value)) {
+    }
+
+    CowSimpleVector(std::initializer_list<Type> init)
+        : data_(std::make_shared<SimpleVector<Type>>(init)) {
+    }
+
+    // Копия разделяет буфер с оригиналом — это O(1), байты не трогаются
+    CowSimpleVector(const CowSimpleVector&) = default;
+    CowSimpleVector& operator=(const CowSimpleVector&) = default;
+    CowSimpleVector(CowSimpleVector&&) = default;
+    CowSimpleVector& operator=(CowSimpleVector&&) = default;
+
+    // Возвращает снимок для читателей за O(1). Снимок держит буфер живым
+    // и не меняется, что бы дальше ни делали с этим вектором
+    std::shared_ptr<const SimpleVector<Type>> SharedSnapshot() const noexcept {
+        return data_;
+    }
+
+    // Сообщает, разделён ли буфер с копиями или снимками
+    bool IsShared() const noexcept {
+        return data_.use_count() > 1;
+    }
+
+    // Возвращает количество элементов в массиве
+    size_t GetSize() const noexcept {
+        return data_->GetSize();
+    }
+
+    // Возвращает вместимость массива
+    size_t GetCapacity() const noexcept {
+        return data_->GetCapacity();
+    }
+
+    // Сообщает, пустой ли массив
+    bool IsEmpty() const noexcept {
+        return data_->IsEmpty();
+    }
+
+    // Чтение элемента — без копирования буфера
+    const Type& operator[](size_t index) const noexcept {
+        return (*data_)[index];
+    }
+
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    const Type& At(size_t index) const {
+        return data_->At(index);
+    }
+
+    ConstIterator begin() const noexcept {
+        return data_->begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return data_->end();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return data_->cbegin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return data_->cend();
+    }
+
+    // Мутирующий доступ к элементу: при разделённом буфере — глубокая копия
+    Type& MutableAt(size_t index) {
+        EnsureUnique();
+        return data_->At(index);
+    }
+
+    // Добавляет элемент в конец вектора
+    void PushBack(const Type& item) {
+        EnsureUnique();
+        data_->PushBack(item);
+    }
+
+    void PushBack(Type&& item) {
+        EnsureUnique();
+        data_->PushBack(std::move(item));
+    }
+
+    // "Удаляет" последний элемент вектора. Вектор не должен быть пустым
+    void PopBack() {
+        EnsureUnique();
+        data_->PopBack();
+    }
+
+    // Изменяет размер массива
+    void Resize(size_t new_size) {
+        EnsureUnique();
+        data_->Resize(new_size);
+    }
+
+    // Обнуляет размер массива
+    void Clear() {
+        EnsureUnique();
+        data_->Clear();
+    }
+
+private:
+    // Перед записью отцепляется от разделённого буфера.
+    // Пока буфер ни с кем не разделён, это одна проверка счётчика
+    void EnsureUnique() {
+        if (data_.use_count() > 1) {
+            data_ = std::make_shared<SimpleVector<Type>>(*data_);
+        }
+    }
+
+    std::shared_ptr<SimpleVector<Type>> data_;
+};
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+// Вектор фиксированной вместимости для таблиц, вычисляемых на этапе
+// компиляции (CRC-таблицы, сетки квантования и т.п.). Все операции constexpr:
+// таблицу можно собрать в constexpr-функции циклом PushBack и положить
+// в constexpr-переменную — данные попадут в .rodata и будут общими
+// для всех процессов без какой-либо работы на старте.
+//
+// Кучный SimpleVector сюда не годится принципиально: память, выделенная
+// в константном вычислении, обязана быть освобождена до его конца,
+// поэтому владеющий кучей контейнер не может дожить до .rodata.
+// Здесь хранилище — обычный массив внутри объекта, элементы за size_
+// хранят значение по умолчанию. Тип должен иметь конструктор по умолчанию
+template <typename Type, size_t Capacity>
+class FixedSimpleVector {
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    constexpr FixedSimpleVector() = default;
+
+    // Создаёт вектор из size элементов со значением по умолчанию
+    constexpr explicit FixedSimpleVector(size_t size)
+        : size_(size) {
+        assert(size <= Capacity);
+    }
+
+    // Создаёт вектор из size элементов со значением value
+    constexpr FixedSimpleVector(size_t size, const Type& value)
+        : size_(size) {
+        assert(size <= Capacity);
+        for (size_t i = 0; i < size; ++i) {
+            items_[i] = value;
+        }
+    }
+
+    constexpr FixedSimpleVector(std::initializer_list<Type> init)
+        : size_(init.size()) {
+        assert(init.size() <= Capacity);
+        size_t i = 0;
+        for (const Type& value : init) {
+            items_[i] = value;
+            ++i;
+        }
+    }
+
+    // Возвращает количество элементов
+    constexpr size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Возвращает вместимость — она задана параметром шаблона
+    constexpr size_t GetCapacity() const noexcept {
+        return Capacity;
+    }
+
+    // Сообщает, пустой ли вектор
+    constexpr bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает ссылку на элемент с индексом index
+    constexpr Type& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return items_[index];
+    }
+
+    // Возвращает константную ссылку на элемент с индексом index
+    constexpr const Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return items_[index];
+    }
+
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    constexpr Type& At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return items_[index];
+    }
+
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    constexpr const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return items_[index];
+    }
+
+    // Добавляет элемент в конец. Места должно хватать: вместимость не растёт
+    constexpr void PushBack(const Type& item) {
+        assert(size_ < Capacity);
+        items_[size_] = item;
+        ++size_;
+    }
+
+    constexpr void PushBack(Type&& item) {
+        assert(size_ < Capacity);
+        items_[size_] = std::move(item);
+        ++size_;
+    }
+
+    // Удаляет последний элемент. Вектор не должен быть пустым
+    constexpr void PopBack() noexcept {
+        assert(size_ != 0);
+        items_[size_ - 1] = Type{};
+        --size_;
+    }
+
+    // Изменяет размер. Новые элементы получают значение по умолчанию
+    constexpr void Resize(size_t new_size) {
+        assert(new_size <= Capacity);
+        for (size_t i = new_size; i < size_; ++i) {
+            items_[i] = Type{};
+        }
+        for (size_t i = size_; i < new_size; ++i) {
+            items_[i] = Type{};
+        }
+        size_ = new_size;
+    }
+
+    // Обнуляет размер
+    constexpr void Clear() noexcept {
+        size_ = 0;
+    }
+
+    constexpr Iterator begin() noexcept {
+        return items_;
+    }
+
+    constexpr Iterator end() noexcept {
+        return items_ + size_;
+    }
+
+    constexpr ConstIterator begin() const noexcept {
+        return items_;
+    }
+
+    constexpr ConstIterator end() const noexcept {
+        return items_ + size_;
+    }
+
+    constexpr ConstIterator cbegin() const noexcept {
+        return items_;
+    }
+
+    constexpr ConstIterator cend() const noexcept {
+        return items_ + size_;
+    }
+
+private:
+    Type items_[Capacity] = {};
+    size_t size_ = 0;
+};
+
+template <typename Type, size_t Capacity>
+constexpr bool operator==(const FixedSimpleVector<Type, Capacity>& lhs,
+                          const FixedSimpleVector<Type, Capacity>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.GetSize(); ++i) {
+        if (!(lhs[i] == rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Type, size_t Capacity>
+constexpr bool operator!=(const FixedSimpleVector<Type, Capacity>& lhs,
+                          const FixedSimpleVector<Type, Capacity>& rhs) {
+    return !(lhs == rhs);
+}
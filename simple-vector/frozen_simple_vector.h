@@ -0,0 +1,337 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "simple_vector.h"
+
+// Холодное хранилище для редко читаемых серий: Freeze() сжимает буфер
+// поблочно, после чего operator[] и обход прозрачно разжимают только
+// затронутый блок через небольшой кэш горячих блоков; Thaw()
+// восстанавливает плоский буфер перед тяжёлой обработкой.
+//
+// Кодек — компактный жадный LZ (хэш-таблица 4-байтовых цепочек, токены
+// литералов и совпадений с 16-битным смещением назад), встроенный прямо
+// сюда, чтобы не тянуть внешнюю библиотеку; худший случай раздувает
+// данные на ~1/128. Блок покрывает
+// целое число элементов, поэтому элемент никогда не рвётся между блоками,
+// а последовательный обход begin()/end() читает блок за блоком,
+// разжимая каждый ровно один раз.
+//
+// Отдельный тип, а не режим SimpleVector: горячий путь обычного вектора
+// остаётся без ветвления "а не заморожен ли я". Ссылка, возвращённая
+// operator[] замороженного вектора, живёт до вытеснения блока из кэша —
+// то есть до обращения к другим блокам; значение следует копировать
+template <typename Type>
+class FrozenSimpleVector {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "FrozenSimpleVector requires a trivially copyable element type");
+
+public:
+    // Итератор последовательного чтения: адресует элементы по номеру,
+    // поэтому остаётся валидным при Freeze/Thaw
+    class ConstIterator {
+        friend class FrozenSimpleVector;
+
+        ConstIterator(const FrozenSimpleVector* container, size_t index) noexcept
+            : container_(container), index_(index) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIterator() = default;
+
+        reference operator*() const {
+            return (*container_)[index_];
+        }
+
+        pointer operator->() const {
+            return &(*container_)[index_];
+        }
+
+        ConstIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept {
+            auto old = *this;
+            ++index_;
+            return old;
+        }
+
+        bool operator==(const ConstIterator& rhs) const noexcept {
+            return container_ == rhs.container_ && index_ == rhs.index_;
+        }
+
+        bool operator!=(const ConstIterator& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+    private:
+        const FrozenSimpleVector* container_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    FrozenSimpleVector() = default;
+
+    // Принимает серию во владение; вектор создаётся в тёплом состоянии
+    explicit FrozenSimpleVector(SimpleVector<Type> source)
+        : flat_(std::move(source)), size_(flat_.GetSize()) {
+    }
+
+    // Возвращает количество элементов
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустой ли вектор
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Сообщает, сжат ли буфер
+    bool IsFrozen() const noexcept {
+        return frozen_;
+    }
+
+    // Возвращает объём сжатого представления в байтах (0 в тёплом состоянии)
+    size_t GetCompressedBytes() const noexcept {
+        size_t total = 0;
+        for (const auto& block : blocks_) {
+            total += block.GetSize();
+        }
+        return total;
+    }
+
+    // Сжимает буфер поблочно и освобождает плоское хранилище.
+    // Дальнейшие чтения разжимают только затронутые блоки
+    void Freeze() {
+        if (frozen_) {
+            return;
+        }
+        size_t block_count = (size_ + kBlockElements - 1) / kBlockElements;
+        blocks_.Reserve(block_count);
+        const auto* bytes = reinterpret_cast<const unsigned char*>(flat_.begin());
+        for (size_t block = 0; block < block_count; ++block) {
+            SimpleVector<unsigned char> compressed;
+            CompressBlock(bytes + block * kBlockBytes, BlockBytes(block), compressed);
+            compressed.ShrinkToFit();
+            blocks_.PushBack(std::move(compressed));
+        }
+        SimpleVector<Type> empty;
+        flat_.swap(empty);
+        InvalidateCache();
+        frozen_ = true;
+    }
+
+    // Восстанавливает плоский буфер и освобождает сжатые блоки
+    void Thaw() {
+        if (!frozen_) {
+            return;
+        }
+        SimpleVector<Type> restored;
+        restored.ResizeUninitialized(size_);
+        auto* bytes = reinterpret_cast<unsigned char*>(restored.begin());
+        for (size_t block = 0; block < blocks_.GetSize(); ++block) {
+            DecompressBlock(blocks_[block], bytes + block * kBlockBytes, BlockBytes(block));
+        }
+        flat_.swap(restored);
+        blocks_.Clear();
+        blocks_.ShrinkToFit();
+        InvalidateCache();
+        frozen_ = false;
+    }
+
+    // Возвращает константную ссылку на элемент с индексом index.
+    // В замороженном состоянии разжимает блок элемента через кэш
+    const Type& operator[](size_t index) const {
+        assert(index < size_);
+        if (!frozen_) {
+            return flat_[index];
+        }
+        const unsigned char* block = CachedBlock(index / kBlockElements);
+        const auto* elements = reinterpret_cast<const Type*>(block);
+        return elements[index % kBlockElements];
+    }
+
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return (*this)[index];
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    // Размер блока сжатия; блок покрывает целое число элементов
+    static constexpr size_t kBlockBytes
+        = sizeof(Type) < 4096 ? 4096 / sizeof(Type) * sizeof(Type) : sizeof(Type);
+    static constexpr size_t kBlockElements = kBlockBytes / sizeof(Type);
+    // Кэш последних разжатых блоков; последовательный обход попадает
+    // в один и тот же блок до его границы
+    static constexpr size_t kCacheSlots = 4;
+    // Токены кодека: c < 128 — за ним c + 1 литеральных байт,
+    // c >= 128 — совпадение длиной c - 128 + 4 с 16-битным смещением назад
+    static constexpr size_t kMaxLiteralRun = 128;
+    static constexpr size_t kMinMatch = 4;
+    static constexpr size_t kMaxMatch = 131;
+    static constexpr size_t kHashSlots = 4096;
+    static constexpr size_t kNoPosition = size_t(-1);
+
+    struct CacheSlot {
+        size_t block = size_t(-1);
+        SimpleVector<unsigned char> bytes;
+    };
+
+    // Размер несжатых данных блока block в байтах (последний блок короче)
+    size_t BlockBytes(size_t block) const noexcept {
+        size_t total = size_ * sizeof(Type);
+        size_t from = block * kBlockBytes;
+        return total - from < kBlockBytes ? total - from : kBlockBytes;
+    }
+
+    // Возвращает разжатые байты блока block, при промахе разжимает его
+    // в вытесняемый по кругу кэш-слот
+    const unsigned char* CachedBlock(size_t block) const {
+        for (const CacheSlot& slot : cache_) {
+            if (slot.block == block) {
+                return slot.bytes.begin();
+            }
+        }
+        CacheSlot& victim = cache_[next_victim_];
+        next_victim_ = (next_victim_ + 1) % kCacheSlots;
+        victim.bytes.ResizeUninitialized(BlockBytes(block));
+        DecompressBlock(blocks_[block], victim.bytes.begin(), BlockBytes(block));
+        victim.block = block;
+        return victim.bytes.begin();
+    }
+
+    void InvalidateCache() const noexcept {
+        for (CacheSlot& slot : cache_) {
+            slot.block = size_t(-1);
+        }
+    }
+
+    // Хэш четырёх байт для таблицы кандидатов на совпадение
+    static size_t HashFour(const unsigned char* data) noexcept {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return (value * 2654435761u) >> 20;  // старшие 12 бит — номер слота
+    }
+
+    // Дописывает литералы [from, to) токенами не длиннее kMaxLiteralRun
+    static void FlushLiterals(const unsigned char* data, size_t from, size_t to,
+                              SimpleVector<unsigned char>& out) {
+        while (from < to) {
+            size_t count = to - from < kMaxLiteralRun ? to - from : kMaxLiteralRun;
+            out.PushBack(static_cast<unsigned char>(count - 1));
+            out.AppendRange(data + from, data + from + count);
+            from += count;
+        }
+    }
+
+    // Жадный LZ: хэш-таблица последних позиций 4-байтовых цепочек,
+    // совпадение кодируется длиной и смещением назад. Повторяющиеся
+    // значения шире байта (float и т.п.) сворачиваются совпадением
+    // с перекрытием — смещением меньше длины
+    static void CompressBlock(const unsigned char* data, size_t size,
+                              SimpleVector<unsigned char>& out) {
+        size_t table[kHashSlots];
+        for (size_t& slot : table) {
+            slot = kNoPosition;
+        }
+
+        size_t literal_start = 0;
+        size_t i = 0;
+        while (i + kMinMatch <= size) {
+            size_t slot = HashFour(data + i);
+            size_t candidate = table[slot];
+            table[slot] = i;
+            if (candidate == kNoPosition || i - candidate > 65535
+                || std::memcmp(data + candidate, data + i, kMinMatch) != 0) {
+                ++i;
+                continue;
+            }
+            size_t length = kMinMatch;
+            while (i + length < size && length < kMaxMatch
+                   && data[candidate + length] == data[i + length]) {
+                ++length;
+            }
+            FlushLiterals(data, literal_start, i, out);
+            size_t offset = i - candidate;
+            out.PushBack(static_cast<unsigned char>(128 + length - kMinMatch));
+            out.PushBack(static_cast<unsigned char>(offset & 0xff));
+            out.PushBack(static_cast<unsigned char>(offset >> 8));
+            i += length;
+            literal_start = i;
+        }
+        FlushLiterals(data, literal_start, size, out);
+    }
+
+    static void DecompressBlock(const SimpleVector<unsigned char>& in,
+                                unsigned char* out, size_t expected) {
+        const unsigned char* cursor = in.begin();
+        const unsigned char* in_end = in.end();
+        unsigned char* out_end = out + expected;
+        while (cursor != in_end) {
+            unsigned char control = *cursor++;
+            if (control < 128) {
+                size_t count = control + size_t(1);
+                assert(cursor + count <= in_end && out + count <= out_end);
+                std::memcpy(out, cursor, count);
+                cursor += count;
+                out += count;
+            }
+            else {
+                size_t count = control - 128 + kMinMatch;
+                assert(cursor + 2 <= in_end && out + count <= out_end);
+                size_t offset = cursor[0] | (size_t(cursor[1]) << 8);
+                cursor += 2;
+                // Побайтовое копирование: источник может перекрываться
+                // с приёмником (смещение меньше длины — повтор образца)
+                const unsigned char* match = out - offset;
+                for (size_t k = 0; k < count; ++k) {
+                    out[k] = match[k];
+                }
+                out += count;
+            }
+        }
+        assert(out == out_end);
+        (void)out_end;
+    }
+
+    SimpleVector<Type> flat_;
+    SimpleVector<SimpleVector<unsigned char>> blocks_;
+    size_t size_ = 0;
+    bool frozen_ = false;
+    mutable CacheSlot cache_[kCacheSlots];
+    mutable size_t next_victim_ = 0;
+};
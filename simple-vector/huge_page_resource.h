@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Ресурс памяти для многогигабайтных векторов: крупные блоки берутся
+// напрямую у ядра через mmap и помечаются madvise(MADV_HUGEPAGE),
+// чтобы ядро собрало их в прозрачные 2МБ-страницы и снизило нагрузку
+// на TLB. Мелкие блоки уходят в резервный ресурс — обычную кучу.
+//
+// Необязательная подсказка NUMA-узла привязывает блок к сокету, который
+// будет его сканировать (mbind), вместо first-touch размещения на узле
+// потока-загрузчика. Привязка и huge pages — best effort: если ядро
+// не может их выполнить, блок остаётся обычным, аллокация не падает.
+//
+// Подключается через конструкторы SimpleVector(resource):
+//     HugePageMemoryResource hugepages;
+//     SimpleVector<double> buffer(1'000'000'000, &hugepages);
+class HugePageMemoryResource : public std::pmr::memory_resource {
+public:
+    // Размер прозрачной огромной страницы на x86-64
+    static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+    // numa_node — узел для привязки блока, -1 — без привязки.
+    // Блоки меньше huge_threshold байт выделяются у ресурса fallback
+    explicit HugePageMemoryResource(int numa_node = -1,
+                                    size_t huge_threshold = kHugePageSize,
+                                    std::pmr::memory_resource* fallback
+                                        = std::pmr::get_default_resource())
+        : numa_node_(numa_node), huge_threshold_(huge_threshold), fallback_(fallback) {
+        assert(fallback != nullptr);
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        if (bytes < huge_threshold_) {
+            return fallback_->allocate(bytes, alignment);
+        }
+        // mmap выравнивает по границе страницы — этого хватает
+        // для любого выравнивания, какое может запросить вектор
+        assert(alignment <= static_cast<size_t>(::sysconf(_SC_PAGESIZE)));
+
+        size_t mapped = RoundUpToHugePage(bytes);
+        void* block = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (block == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#ifdef MADV_HUGEPAGE
+        ::madvise(block, mapped, MADV_HUGEPAGE);
+#endif
+        BindToNode(block, mapped);
+        return block;
+    }
+
+    void do_deallocate(void* block, size_t bytes, size_t alignment) override {
+        if (bytes < huge_threshold_) {
+            fallback_->deallocate(block, bytes, alignment);
+            return;
+        }
+        ::munmap(block, RoundUpToHugePage(bytes));
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    static size_t RoundUpToHugePage(size_t bytes) {
+        return (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+    }
+
+    // Привязывает блок к numa_node_ (MPOL_BIND). Вызывается напрямую
+    // через syscall, чтобы не тянуть зависимость от libnuma;
+    // на ядрах без NUMA вызов просто игнорируется
+    void BindToNode(void* block, size_t mapped) const {
+#ifdef SYS_mbind
+        if (numa_node_ < 0) {
+            return;
+        }
+        const int kMpolBind = 2;
+        unsigned long nodemask = 1ul << numa_node_;
+        ::syscall(SYS_mbind, block, mapped, kMpolBind, &nodemask,
+                  sizeof(nodemask) * 8, 0ul);
+#else
+        (void)block;
+        (void)mapped;
+#endif
+    }
+
+    int numa_node_ = -1;
+    size_t huge_threshold_ = kHugePageSize;
+    std::pmr::memory_resource* fallback_ = std::pmr::get_default_resource();
+};
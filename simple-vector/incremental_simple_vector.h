@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "array_ptr.h"
+
+// Вектор с инкрементальным переездом для всегда-дописывающих буферов
+// (телеметрия и т.п.), где неприемлем даже один синхронный O(n)-перенос
+// при удвоении. Когда текущий буфер заполняется, выделяется следующий
+// (вдвое больше), но элементы не переносятся разом: каждый последующий
+// PushBack доносит не более migrate_step элементов. Худшая цена одного
+// добавления жёстко ограничена: выделение буфера плюс migrate_step
+// перемещений — независимо от размера вектора.
+//
+// Пока переезд не завершён, operator[] сверяется с границей переезда
+// (один предсказуемый переход). До следующего удвоения переезд
+// гарантированно заканчивается: свободных ячеек нового буфера больше,
+// чем элементов в старом, уже при migrate_step == 1.
+//
+// Тип должен перемещаться без исключений: прерванный на середине
+// поэлементный переезд откатить нельзя
+template <typename Type>
+class IncrementalSimpleVector {
+    static_assert(std::is_nothrow_move_constructible_v<Type>,
+                  "IncrementalSimpleVector requires a nothrow move constructor");
+
+public:
+    IncrementalSimpleVector() noexcept = default;
+
+    // Буферы выделяются у ресурса resource; migrate_step — максимум
+    // элементов, доносимых одним PushBack
+    explicit IncrementalSimpleVector(std::pmr::memory_resource* resource,
+                                     size_t migrate_step = 8) noexcept
+        : resource_(resource), migrate_step_(migrate_step) {
+        assert(resource != nullptr);
+        assert(migrate_step != 0);
+    }
+
+    IncrementalSimpleVector(IncrementalSimpleVector&& other) noexcept
+        : resource_(other.resource_),
+          migrate_step_(other.migrate_step_),
+          active_(std::move(other.active_)),
+          next_(std::move(other.next_)),
+          size_(std::exchange(other.size_, 0)),
+          migrated_(std::exchange(other.migrated_, 0)) {
+    }
+
+    IncrementalSimpleVector(const IncrementalSimpleVector&) = delete;
+    IncrementalSimpleVector& operator=(const IncrementalSimpleVector&) = delete;
+    IncrementalSimpleVector& operator=(IncrementalSimpleVector&&) = delete;
+
+    ~IncrementalSimpleVector() {
+        DestroyAll();
+    }
+
+    // Возвращает количество элементов
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Возвращает вместимость: во время переезда — вместимость нового буфера
+    size_t GetCapacity() const noexcept {
+        return next_ ? next_.GetCapacity() : active_.GetCapacity();
+    }
+
+    // Сообщает, пустой ли вектор
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Сообщает, идёт ли сейчас поэтапный переезд в новый буфер
+    bool IsMigrating() const noexcept {
+        return static_cast<bool>(next_);
+    }
+
+    // Возвращает ссылку на элемент с индексом index
+    Type& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return *Slot(index);
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return *Slot(index);
+    }
+
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    Type& At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return *Slot(index);
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return *Slot(index);
+    }
+
+    // Добавляет элемент в конец. Худший случай — выделение следующего
+    // буфера и migrate_step перемещений, но никогда не полный переезд
+    void PushBack(const Type& item) {
+        new (SlotForPushBack()) Type(item);
+        ++size_;
+        AdvanceMigration();
+    }
+
+    void PushBack(Type&& item) {
+        new (SlotForPushBack()) Type(std::move(item));
+        ++size_;
+        AdvanceMigration();
+    }
+
+    // Конструирует элемент в конце прямо в хранилище из args
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        Type* slot = SlotForPushBack();
+        new (slot) Type(std::forward<Args>(args)...);
+        ++size_;
+        AdvanceMigration();
+        return *slot;
+    }
+
+    // Доносит остаток элементов в новый буфер за один вызов —
+    // например, перед горячим циклом чтения, чтобы убрать ветку из Slot
+    void FinishMigration() {
+        while (next_) {
+            MigrateStep(migrate_step_);
+        }
+    }
+
+    // Разрушает все элементы. Текущий буфер остаётся за вектором
+    void Clear() noexcept {
+        DestroyAll();
+        if (next_) {
+            // Завершаем переезд без элементов: новый буфер становится текущим
+            active_ = std::move(next_);
+            next_ = RawArrayPtr<Type>();
+        }
+        size_ = 0;
+        migrated_ = 0;
+    }
+
+private:
+    // Адрес элемента index с учётом границы переезда
+    Type* Slot(size_t index) const noexcept {
+        if (next_ && index >= migrated_ && index < active_.GetCapacity()) {
+            return active_.Get() + index;
+        }
+        return (next_ ? next_.Get() : active_.Get()) + index;
+    }
+
+    // Возвращает сырую ячейку под следующий элемент,
+    // при необходимости запуская переезд
+    Type* SlotForPushBack() {
+        size_t capacity = GetCapacity();
+        if (size_ == capacity) {
+            if (capacity == 0) {
+                active_ = RawArrayPtr<Type>(kInitialCapacity, resource_);
+            }
+            else {
+                // Только выделение: элементы поедут по частям
+                assert(!next_);
+                next_ = RawArrayPtr<Type>(capacity * 2, resource_);
+            }
+        }
+        return (next_ ? next_.Get() : active_.Get()) + size_;
+    }
+
+    // Доносит очередную порцию элементов; завершает переезд, когда старый
+    // буфер опустел
+    void AdvanceMigration() noexcept {
+        if (next_) {
+            MigrateStep(migrate_step_);
+        }
+    }
+
+    void MigrateStep(size_t max_count) noexcept {
+        size_t boundary = std::min(active_.GetCapacity(), size_);
+        size_t count = std::min(max_count, boundary - migrated_);
+        for (size_t i = 0; i < count; ++i, ++migrated_) {
+            new (next_.Get() + migrated_) Type(std::move(active_[migrated_]));
+            std::destroy_at(active_.Get() + migrated_);
+        }
+        if (migrated_ == active_.GetCapacity()) {
+            active_ = std::move(next_);
+            next_ = RawArrayPtr<Type>();
+            migrated_ = 0;
+        }
+    }
+
+    void DestroyAll() noexcept {
+        for (size_t i = 0; i < size_; ++i) {
+            std::destroy_at(Slot(i));
+        }
+    }
+
+    // Стартовая вместимость первого буфера
+    static constexpr size_t kInitialCapacity = 8;
+
+    std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+    size_t migrate_step_ = 8;
+    RawArrayPtr<Type> active_;
+    RawArrayPtr<Type> next_;
+    size_t size_ = 0;
+    size_t migrated_ = 0;
+};
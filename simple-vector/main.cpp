@@ -1,9 +1,26 @@
+#include "concurrent_simple_vector.h"
+#include "cow_simple_vector.h"
+#include "fixed_simple_vector.h"
+#include "frozen_simple_vector.h"
+#include "huge_page_resource.h"
+#include "incremental_simple_vector.h"
+#include "recycling_resource.h"
+#include "segmented_simple_vector.h"
 #include "simple_vector.h"
+#include "simple_vector_io.h"
+#include "simple_vector_view.h"
+#include "small_simple_vector.h"
+#include "soa_simple_vector.h"
+#include "sorted_simple_vector.h"
 
 #include <cassert>
+#include <cstdio>
 #include <iostream>
+#include <memory_resource>
 #include <numeric>
+#include <sstream>
 #include <string>
+#include <thread>
 
 using namespace std;
 
@@ -137,6 +154,24 @@ void TestNoncopiableInsert() {
     cout << "Done!"s << endl << endl;
 }
 
+void TestEmplace() {
+    const size_t size = 5;
+    cout << "Test emplace back and emplace"s << endl;
+    SimpleVector<X> v;
+    for (size_t i = 0; i < size; ++i) {
+        X& ref = v.EmplaceBack(i);
+        assert(ref.GetX() == i);
+    }
+    assert(v.GetSize() == size);
+
+    auto it = v.Emplace(v.begin() + 2, size + 1);
+    assert(it->GetX() == size + 1);
+    assert(v.GetSize() == size + 1);
+    assert(v[2].GetX() == size + 1);
+    assert(v[3].GetX() == 2);
+    cout << "Done!"s << endl << endl;
+}
+
 void TestNoncopiableErase() {
     const size_t size = 3;
     cout << "Test noncopiable erase"s << endl;
@@ -150,6 +185,959 @@ void TestNoncopiableErase() {
     cout << "Done!"s << endl << endl;
 }
 
+void TestSmallVector() {
+    cout << "Test small vector inline storage"s << endl;
+    SmallSimpleVector<int, 8> v;
+    assert(v.IsInline());
+    assert(v.GetCapacity() == 8);
+    for (int i = 0; i < 8; ++i) {
+        v.PushBack(i);
+    }
+    assert(v.IsInline());
+
+    // Девятый элемент вытесняет вектор в кучу
+    v.PushBack(8);
+    assert(!v.IsInline());
+    assert(v.GetSize() == 9);
+    for (int i = 0; i < 9; ++i) {
+        assert(v[i] == i);
+    }
+
+    // swap инлайн- и кучного вектора
+    SmallSimpleVector<int, 8> small;
+    small.PushBack(42);
+    v.swap(small);
+    assert(v.GetSize() == 1 && v[0] == 42);
+    assert(small.GetSize() == 9 && small[8] == 8);
+
+    // Перемещение инлайн-вектора переносит элементы поштучно
+    SmallSimpleVector<int, 8> moved(move(v));
+    assert(moved.GetSize() == 1 && moved[0] == 42);
+    assert(v.GetSize() == 0);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestAppendRange() {
+    cout << "Test append range and range insert"s << endl;
+    SimpleVector<int> v;
+    int data[] = {1, 2, 3, 4, 5};
+    v.AppendRange(begin(data), std::end(data));
+    assert(v.GetSize() == 5);
+    assert(v.GetCapacity() == 5);
+    for (int i = 0; i < 5; ++i) {
+        assert(v[i] == i + 1);
+    }
+
+    // Вставка диапазона в середину
+    int extra[] = {10, 20};
+    auto it = v.Insert(v.begin() + 2, begin(extra), std::end(extra));
+    assert(*it == 10);
+    assert(v.GetSize() == 7);
+    assert((v == SimpleVector<int>{1, 2, 10, 20, 3, 4, 5}));
+
+    // Вставка в конец без реаллокации
+    v.Reserve(16);
+    auto cap = v.GetCapacity();
+    v.Insert(v.end(), begin(extra), std::end(extra));
+    assert(v.GetCapacity() == cap);
+    assert(v.GetSize() == 9);
+    assert(v[7] == 10 && v[8] == 20);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestShrinkToFit() {
+    cout << "Test shrink to fit and growth policy"s << endl;
+    SimpleVector<int> v;
+    v.SetGrowthFactor(1.5);
+    for (int i = 0; i < 100; ++i) {
+        v.PushBack(i);
+    }
+    assert(v.GetCapacity() > v.GetSize());
+
+    v.ShrinkToFit();
+    assert(v.GetCapacity() == v.GetSize());
+    for (int i = 0; i < 100; ++i) {
+        assert(v[i] == i);
+    }
+
+    // Порог не достигнут — вместимость не меняется
+    v.SetShrinkThreshold(0.25);
+    v.Resize(50);
+    v.MaybeShrinkToFit();
+    assert(v.GetCapacity() == 100);
+    // Порог достигнут — вместимость сжимается до размера
+    v.Resize(10);
+    v.MaybeShrinkToFit();
+    assert(v.GetCapacity() == 10);
+
+    v.Clear();
+    v.ShrinkToFit();
+    assert(v.GetCapacity() == 0);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestMemoryResource() {
+    cout << "Test custom memory resource"s << endl;
+    pmr::monotonic_buffer_resource arena(4096);
+    SimpleVector<int> v(&arena);
+    assert(v.GetMemoryResource() == &arena);
+    for (int i = 0; i < 100; ++i) {
+        v.PushBack(i);
+    }
+    assert(v.GetSize() == 100);
+    for (int i = 0; i < 100; ++i) {
+        assert(v[i] == i);
+    }
+
+    // Перемещение сохраняет привязку к ресурсу
+    SimpleVector<int> moved(move(v));
+    assert(moved.GetMemoryResource() == &arena);
+    assert(moved.GetSize() == 100);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestResizeUninitialized() {
+    cout << "Test uninitialized resize and overwrite"s << endl;
+    SimpleVector<char> buf;
+    buf.ResizeUninitialized(128);
+    assert(buf.GetSize() == 128);
+    // Имитация recv(): ядро пишет прямо в буфер
+    for (size_t i = 0; i < buf.GetSize(); ++i) {
+        buf[i] = static_cast<char>('a' + i % 26);
+    }
+    assert(buf[0] == 'a' && buf[26] == 'a');
+
+    buf.ResizeAndOverwrite(64, [](char* data, size_t size) {
+        size_t written = size / 2;
+        for (size_t i = 0; i < written; ++i) {
+            data[i] = 'x';
+        }
+        return written;
+    });
+    assert(buf.GetSize() == 32);
+    assert(buf[0] == 'x' && buf[31] == 'x');
+    cout << "Done!"s << endl << endl;
+}
+
+void TestAdoptRelease() {
+    cout << "Test adopt and release buffer"s << endl;
+    auto* resource = pmr::get_default_resource();
+
+    // Буфер "из драйвера": выделен у того же ресурса, что освободит вектор
+    const size_t capacity = 16;
+    auto* buf = static_cast<int*>(resource->allocate(capacity * sizeof(int), alignof(int)));
+    for (int i = 0; i < 10; ++i) {
+        buf[i] = i * i;
+    }
+
+    auto v = SimpleVector<int>::Adopt(buf, 10, capacity, resource);
+    assert(v.GetSize() == 10);
+    assert(v.GetCapacity() == capacity);
+    assert(v.begin() == buf);
+    assert(v[3] == 9);
+    v.PushBack(100);
+    assert(v.GetSize() == 11);
+
+    // Обратный путь: буфер уходит вызывающему без копирования
+    auto released = v.ReleaseBuffer();
+    assert(v.GetSize() == 0 && v.GetCapacity() == 0);
+    assert(released.data == buf);
+    assert(released.size == 11);
+    assert(released.capacity == capacity);
+    assert(released.data[10] == 100);
+    released.resource->deallocate(released.data, released.capacity * sizeof(int), alignof(int));
+    cout << "Done!"s << endl << endl;
+}
+
+void TestVectorView() {
+    cout << "Test mmap snapshot view"s << endl;
+    const string path = "test_snapshot.bin"s;
+    {
+        SimpleVector<int> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(i * 3);
+        }
+        SaveToFile(v, path);
+    }
+
+    {
+        SimpleVectorView<int> view(path);
+        assert(view.GetSize() == 1000);
+        assert(view[0] == 0 && view[999] == 2997);
+        assert(view.At(500) == 1500);
+        int sum = accumulate(view.begin(), view.end(), 0);
+        assert(sum == 3 * 999 * 1000 / 2);
+
+        // Чтение чужим типом должно отвергаться заголовком
+        bool thrown = false;
+        try {
+            SimpleVectorView<double> wrong(path);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    remove(path.c_str());
+    cout << "Done!"s << endl << endl;
+}
+
+void TestParallelFill() {
+    cout << "Test parallel fill and generate"s << endl;
+    const size_t size = 300000;
+    auto filled = SimpleVector<double>::FilledParallel(size, 1.5);
+    assert(filled.GetSize() == size);
+    assert(filled[0] == 1.5 && filled[size - 1] == 1.5);
+
+    auto generated = SimpleVector<size_t>::GeneratedParallel(size, [](size_t i) noexcept {
+        return i * 2;
+    });
+    assert(generated.GetSize() == size);
+    for (size_t i = 0; i < size; ++i) {
+        assert(generated[i] == i * 2);
+    }
+
+    // Малый размер идёт по последовательной ветке
+    auto small_filled = SimpleVector<int>::FilledParallel(10, 7);
+    assert(small_filled.GetSize() == 10 && small_filled[9] == 7);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestCompare() {
+    cout << "Test single-pass compare"s << endl;
+    SimpleVector<uint8_t> a;
+    SimpleVector<uint8_t> b;
+    for (int i = 0; i < 1000; ++i) {
+        a.PushBack(static_cast<uint8_t>(i % 251));
+        b.PushBack(static_cast<uint8_t>(i % 251));
+    }
+    assert(a == b);
+    assert(a.Compare(b) == 0);
+    assert(a <= b && a >= b && !(a < b) && !(a > b));
+
+    b[500] = 255;
+    assert(a != b);
+    assert(a.Compare(b) < 0);
+    assert(a < b && a <= b && b > a && b >= a);
+
+    // Префикс меньше более длинного вектора
+    SimpleVector<uint8_t> prefix;
+    prefix.AppendRange(a.begin(), a.begin() + 10);
+    assert(prefix < a);
+    assert(prefix.Compare(a) < 0 && a.Compare(prefix) > 0);
+
+    // Нетривиальный тип идёт по поэлементной ветке
+    SimpleVector<string> s1{"alpha"s, "beta"s};
+    SimpleVector<string> s2{"alpha"s, "gamma"s};
+    assert(s1 < s2 && s1.Compare(s2) < 0);
+
+    // Трёхстороннее сравнение — тот же единственный проход
+    assert(ThreeWayCompare(s1, s2) < 0);
+    assert(ThreeWayCompare(s2, s1) > 0);
+    assert(ThreeWayCompare(a, a) == 0);
+#if defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907L
+    assert((s1 <=> s2) < 0);
+    assert((a <=> a) == 0);
+#endif
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSwapAndPopEraseIf() {
+    cout << "Test swap-and-pop and erase-if"s << endl;
+    SimpleVector<int> v{10, 20, 30, 40, 50};
+
+    // SwapAndPop не сдвигает хвост: на место удалённого встаёт последний
+    auto it = v.SwapAndPop(v.begin() + 1);
+    assert(v.GetSize() == 4);
+    assert(*it == 50);
+    assert(v[0] == 10 && v[1] == 50 && v[2] == 30 && v[3] == 40);
+
+    // Удаление последнего элемента — без самоперемещения
+    v.SwapAndPop(v.begin() + 3);
+    assert(v.GetSize() == 3 && v[2] == 30);
+
+    // PopBack разрушает последний элемент на месте
+    v.PopBack();
+    assert(v.GetSize() == 2 && v[0] == 10 && v[1] == 50);
+
+    // EraseIf уплотняет за один проход и возвращает число удалённых
+    SimpleVector<int> nums;
+    for (int i = 0; i < 100; ++i) {
+        nums.PushBack(i);
+    }
+    size_t removed = nums.EraseIf([](int x) {
+        return x % 2 == 0;
+    });
+    assert(removed == 50);
+    assert(nums.GetSize() == 50);
+    for (size_t i = 0; i < nums.GetSize(); ++i) {
+        assert(nums[i] == static_cast<int>(i) * 2 + 1);
+    }
+    assert(nums.EraseIf([](int) {
+        return false;
+    }) == 0);
+    assert(nums.GetSize() == 50);
+
+    // Перемещаемый тип проходит по move-ветке уплотнения
+    SimpleVector<X> xs;
+    for (size_t i = 0; i < 10; ++i) {
+        xs.PushBack(X(i));
+    }
+    xs.EraseIf([](const X& x) {
+        return x.GetX() < 5;
+    });
+    assert(xs.GetSize() == 5);
+    assert(xs.begin()->GetX() == 5);
+    xs.SwapAndPop(xs.begin());
+    assert(xs.GetSize() == 4 && xs.begin()->GetX() == 9);
+    cout << "Done!"s << endl << endl;
+}
+
+// Таблица, целиком вычисленная на этапе компиляции
+constexpr FixedSimpleVector<uint32_t, 16> MakeSquaresTable() {
+    FixedSimpleVector<uint32_t, 16> table;
+    for (uint32_t i = 0; i < 16; ++i) {
+        table.PushBack(i * i);
+    }
+    return table;
+}
+
+constexpr auto kSquaresTable = MakeSquaresTable();
+static_assert(kSquaresTable.GetSize() == 16);
+static_assert(kSquaresTable[5] == 25);
+static_assert(!kSquaresTable.IsEmpty());
+static_assert(kSquaresTable == MakeSquaresTable());
+
+void TestFixedVector() {
+    cout << "Test constexpr fixed vector"s << endl;
+    // Таблица уже готова к моменту запуска — просто читаем её
+    for (size_t i = 0; i < kSquaresTable.GetSize(); ++i) {
+        assert(kSquaresTable[i] == i * i);
+    }
+
+    // Обычное использование во время выполнения
+    FixedSimpleVector<int, 4> v{1, 2, 3};
+    assert(v.GetSize() == 3 && v.GetCapacity() == 4);
+    v.PushBack(4);
+    assert(v.At(3) == 4);
+    v.PopBack();
+    v.Resize(4);
+    assert(v[3] == 0);
+
+    try {
+        v.At(10);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    // Содержимое переносится в кучный SimpleVector одним AppendRange
+    SimpleVector<uint32_t> runtime_copy;
+    runtime_copy.AppendRange(kSquaresTable.begin(), kSquaresTable.end());
+    assert(runtime_copy.GetSize() == 16 && runtime_copy[15] == 225);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestCowVector() {
+    cout << "Test copy-on-write sharing"s << endl;
+    CowSimpleVector<int> writer;
+    for (int i = 0; i < 100; ++i) {
+        writer.PushBack(i);
+    }
+    assert(!writer.IsShared());
+
+    // Снимок и копия получают тот же буфер без копирования элементов
+    auto snapshot = writer.SharedSnapshot();
+    CowSimpleVector<int> reader(writer);
+    assert(writer.IsShared());
+    assert(snapshot->begin() == reader.begin());
+    assert(writer.begin() == reader.begin());
+
+    // Первая запись отцепляет писателя; читатели видят старые данные
+    writer.MutableAt(0) = -1;
+    assert(writer.begin() != reader.begin());
+    assert(writer[0] == -1);
+    assert(reader[0] == 0);
+    assert((*snapshot)[0] == 0);
+    assert(snapshot->GetSize() == 100);
+
+    // Следующие записи буфер уже не копируют
+    auto detached = writer.begin();
+    writer.PushBack(100);
+    writer.MutableAt(1) = -2;
+    assert(writer.GetSize() == 101);
+    assert(reader.GetSize() == 100);
+
+    // Снимок живёт, даже когда исходные векторы исчезли
+    CowSimpleVector<int> temp(1, 7);
+    auto last = temp.SharedSnapshot();
+    temp.Clear();
+    assert(last->GetSize() == 1 && last->At(0) == 7);
+    (void)detached;
+    cout << "Done!"s << endl << endl;
+}
+
+void TestVectorIo() {
+    cout << "Test streaming serialization"s << endl;
+    // Тривиальный тип через поток: заголовок плюс один блок
+    SimpleVector<int64_t> ints;
+    for (int64_t i = 0; i < 1000; ++i) {
+        ints.PushBack(i * 7);
+    }
+    stringstream stream;
+    WriteTo(ints, stream);
+    auto ints_restored = ReadFrom<int64_t>(stream);
+    assert(ints_restored == ints);
+
+    // Тривиальный тип через файловый дескриптор
+    const string path = "test_io.bin"s;
+    int fd = ::open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    assert(fd >= 0);
+    WriteTo(ints, fd);
+    ::close(fd);
+    fd = ::open(path.c_str(), O_RDONLY);
+    assert(fd >= 0);
+    auto from_fd = ReadFrom<int64_t>(fd);
+    ::close(fd);
+    remove(path.c_str());
+    assert(from_fd == ints);
+
+    // Нетривиальный тип через кодек: длина строки + байты
+    SimpleVector<string> words{"alpha"s, ""s, "a much longer payload string"s};
+    stringstream codec_stream;
+    WriteTo(words, codec_stream, [](const string& word, SimpleVector<unsigned char>& out) {
+        uint32_t length = static_cast<uint32_t>(word.size());
+        auto bytes = reinterpret_cast<const unsigned char*>(&length);
+        out.AppendRange(bytes, bytes + sizeof(length));
+        auto chars = reinterpret_cast<const unsigned char*>(word.data());
+        out.AppendRange(chars, chars + word.size());
+    });
+    auto words_restored = ReadFrom<string>(
+        codec_stream, [](const unsigned char*& cursor, const unsigned char* end) {
+            uint32_t length = 0;
+            assert(cursor + sizeof(length) <= end);
+            memcpy(&length, cursor, sizeof(length));
+            cursor += sizeof(length);
+            assert(cursor + length <= end);
+            string word(reinterpret_cast<const char*>(cursor), length);
+            cursor += length;
+            return word;
+        });
+    assert(words_restored == words);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestHugePageResource() {
+    cout << "Test huge page memory resource"s << endl;
+    HugePageMemoryResource hugepages;
+
+    // Крупный буфер уходит в mmap-ветку (больше порога в 2МБ)
+    const size_t size = HugePageMemoryResource::kHugePageSize / sizeof(double) + 1000;
+    SimpleVector<double> big(size, 1.25, &hugepages);
+    assert(big.GetSize() == size);
+    assert(big[0] == 1.25 && big[size - 1] == 1.25);
+    big.PushBack(2.5);
+    assert(big[size] == 2.5);
+
+    // Мелкий вектор обслуживает резервный ресурс — обычная куча
+    SimpleVector<int> tiny(&hugepages);
+    for (int i = 0; i < 100; ++i) {
+        tiny.PushBack(i);
+    }
+    assert(tiny.GetSize() == 100 && tiny[99] == 99);
+
+    // Ресурс переезжает вместе с буфером при перемещении
+    SimpleVector<double> moved(move(big));
+    assert(moved.GetMemoryResource() == &hugepages);
+    assert(moved.GetSize() == size + 1);
+
+    // Подсказка NUMA-узла не мешает аллокации на машине без этого узла
+    HugePageMemoryResource node_bound(0);
+    SimpleVector<double> bound(size, 0.5, &node_bound);
+    assert(bound[size - 1] == 0.5);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSoAVector() {
+    cout << "Test structure-of-arrays vector"s << endl;
+    // Запись: цена, объём, имя инструмента — горячие только первые два поля
+    SimpleSoAVector<int64_t, uint32_t, string> orders;
+    orders.Reserve(100);
+    for (int i = 0; i < 100; ++i) {
+        orders.PushBack(i * 10, static_cast<uint32_t>(i), "order-"s + to_string(i));
+    }
+    assert(orders.GetSize() == 100);
+    assert(orders.GetCapacity() == 100);
+
+    // Горячий скан идёт по плотной колонке, не трогая строки
+    int64_t total = accumulate(orders.Column<0>().begin(), orders.Column<0>().end(),
+                               static_cast<int64_t>(0));
+    assert(total == 10 * 99 * 100 / 2);
+
+    // operator[] собирает запись из колонок кортежем ссылок
+    auto record = orders[5];
+    assert(get<0>(record) == 50 && get<1>(record) == 5u);
+    assert(get<2>(record) == "order-5"s);
+    get<0>(record) = -1;
+    assert(orders.Column<0>()[5] == -1);
+
+    const auto& const_orders = orders;
+    assert(get<1>(const_orders[7]) == 7u);
+
+    orders.Resize(10);
+    assert(orders.GetSize() == 10 && orders.Column<2>().GetSize() == 10);
+    orders.PopBack();
+    assert(orders.GetSize() == 9);
+    orders.Clear();
+    assert(orders.IsEmpty());
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSegmentedVector() {
+    cout << "Test segmented vector"s << endl;
+    SegmentedSimpleVector<int, 64> v;
+    assert(v.IsEmpty() && v.GetCapacity() == 0);
+
+    // Рост добавляет блоки; адреса записанных элементов не меняются
+    v.PushBack(0);
+    const int* first = &v[0];
+    for (int i = 1; i < 1000; ++i) {
+        v.PushBack(i);
+    }
+    assert(&v[0] == first);
+    assert(v.GetSize() == 1000);
+    assert(v.GetCapacity() == 1024);
+    for (int i = 0; i < 1000; ++i) {
+        assert(v[i] == i);
+    }
+
+    // Последовательный обход итератором
+    int64_t sum = 0;
+    for (int value : v) {
+        sum += value;
+    }
+    assert(sum == 999 * 1000 / 2);
+
+    v.PopBack();
+    assert(v.GetSize() == 999);
+    v.Resize(10);
+    assert(v.GetSize() == 10 && v[9] == 9);
+    v.Resize(100);
+    assert(v[50] == 0);
+    assert(v.At(99) == 0);
+    try {
+        v.At(100);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    // Неперемещаемые адреса позволяют держать ссылки через рост
+    SegmentedSimpleVector<string, 8> words;
+    words.PushBack("keep"s);
+    const string& kept = words[0];
+    for (int i = 0; i < 100; ++i) {
+        words.EmplaceBack(to_string(i));
+    }
+    assert(kept == "keep"s);
+    assert(words[100] == "99"s);
+
+    // Перемещаемый тип
+    SegmentedSimpleVector<X, 4> xs;
+    for (size_t i = 0; i < 10; ++i) {
+        xs.EmplaceBack(i);
+    }
+    SegmentedSimpleVector<X, 4> moved(move(xs));
+    assert(moved.GetSize() == 10 && moved[9].GetX() == 9);
+    assert(xs.GetSize() == 0);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestIncrementalVector() {
+    cout << "Test incremental migration"s << endl;
+    IncrementalSimpleVector<size_t> v;
+    bool saw_migration = false;
+    for (size_t i = 0; i < 100000; ++i) {
+        v.PushBack(i);
+        saw_migration = saw_migration || v.IsMigrating();
+        // Во время переезда все элементы читаются сквозь границу
+        if (v.IsMigrating()) {
+            assert(v[0] == 0);
+            assert(v[i] == i);
+        }
+    }
+    assert(saw_migration);
+    assert(v.GetSize() == 100000);
+    for (size_t i = 0; i < 100000; ++i) {
+        assert(v[i] == i);
+    }
+
+    // FinishMigration убирает границу перед горячим чтением
+    IncrementalSimpleVector<string> words(pmr::get_default_resource(), 1);
+    for (int i = 0; i < 50; ++i) {
+        words.PushBack(to_string(i));
+    }
+    words.FinishMigration();
+    assert(!words.IsMigrating());
+    assert(words.GetSize() == 50);
+    assert(words[0] == "0"s && words.At(49) == "49"s);
+
+    try {
+        words.At(50);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    // Clear посреди переезда оставляет вектор в согласованном состоянии
+    IncrementalSimpleVector<string> cleared;
+    for (int i = 0; i < 9; ++i) {
+        cleared.PushBack("value"s);
+    }
+    cleared.Clear();
+    assert(cleared.IsEmpty() && !cleared.IsMigrating());
+    cleared.PushBack("again"s);
+    assert(cleared[0] == "again"s);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSpanAccess() {
+    cout << "Test unchecked access and spans"s << endl;
+    SimpleVector<int> v;
+    for (int i = 0; i < 100; ++i) {
+        v.PushBack(i);
+    }
+
+    // UncheckedAt читает без проверок — контракт на вызывающем
+    int64_t sum = 0;
+    for (size_t i = 0; i < v.GetSize(); ++i) {
+        sum += v.UncheckedAt(i);
+    }
+    assert(sum == 99 * 100 / 2);
+    v.UncheckedAt(0) = -5;
+    assert(v[0] == -5);
+    v.UncheckedAt(0) = 0;
+
+    // Представление видит живые элементы и работает в циклах по диапазону
+    auto span = v.AsSpan();
+    assert(span.GetSize() == 100);
+    assert(!span.IsEmpty());
+    span[1] = 111;
+    assert(v[1] == 111);
+    int64_t span_sum = 0;
+    for (int value : span) {
+        span_sum += value;
+    }
+    assert(span_sum == sum + 110);
+
+    // Поддиапазон со своими границами
+    auto middle = span.Subspan(10, 5);
+    assert(middle.GetSize() == 5);
+    assert(middle[0] == 10 && middle[4] == 14);
+
+    // Константный вектор отдаёт представление только для чтения
+    const auto& const_v = v;
+    SimpleVectorSpan<const int> read_only = const_v.AsSpan();
+    assert(read_only[50] == 50);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSortedVector() {
+    cout << "Test sorted index and eytzinger probes"s << endl;
+    SortedSimpleVector<uint64_t> index;
+    // Вставка вразнобой — хранение всегда сортированное
+    for (uint64_t value : {50u, 10u, 30u, 20u, 40u}) {
+        index.Insert(value);
+    }
+    assert(index.GetSize() == 5);
+    for (size_t i = 1; i < index.GetSize(); ++i) {
+        assert(index[i - 1] < index[i]);
+    }
+
+    assert(index.Contains(30));
+    assert(!index.Contains(35));
+    assert(*index.LowerBound(25) == 30);
+    assert(index.LowerBound(100) == index.end());
+
+    // Раскладка Эйценгера даёт те же ответы без ветвлений в спуске
+    SortedSimpleVector<uint64_t> big;
+    big.Reserve(10000);
+    for (uint64_t i = 0; i < 10000; ++i) {
+        big.Insert(i * 3);
+    }
+    big.BuildEytzinger();
+    assert(big.HasEytzingerLayout());
+    for (uint64_t probe = 0; probe < 30000; probe += 7) {
+        bool expected = probe % 3 == 0;
+        assert(big.Contains(probe) == expected);
+        const uint64_t* found = big.EytzingerLowerBound(probe);
+        auto classic = big.LowerBound(probe);
+        if (classic == big.end()) {
+            assert(found == nullptr);
+        } else {
+            assert(found != nullptr && *found == *classic);
+        }
+    }
+    assert(big.EytzingerLowerBound(1000000) == nullptr);
+
+    // Мутация сбрасывает раскладку, поиск остаётся корректным
+    big.Insert(29999);
+    assert(!big.HasEytzingerLayout());
+    assert(big.Contains(29999));
+    big.Erase(big.LowerBound(29999));
+    assert(!big.Contains(29999));
+    cout << "Done!"s << endl << endl;
+}
+
+// Вышестоящий ресурс, считающий обращения к куче
+class CountingResource : public pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t deallocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* block, size_t bytes, size_t alignment) override {
+        ++deallocations;
+        pmr::get_default_resource()->deallocate(block, bytes, alignment);
+    }
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+void TestRecyclingResource() {
+    cout << "Test recycling pool"s << endl;
+    CountingResource heap;
+    RecyclingMemoryResource pool(&heap);
+
+    // Прогрев: первый буфер приходит из кучи
+    {
+        SimpleVector<char> buffer(4096, 'x', &pool);
+        assert(buffer.GetSize() == 4096);
+    }
+    size_t warmup_allocations = heap.allocations;
+    assert(warmup_allocations == 1);
+    assert(pool.GetCachedBytes() != 0);
+
+    // Установившийся режим: буферы ходят через свободный список, куча молчит
+    for (int i = 0; i < 100000; ++i) {
+        SimpleVector<char> buffer(4096, 'y', &pool);
+        assert(buffer[0] == 'y');
+    }
+    assert(heap.allocations == warmup_allocations);
+    assert(heap.deallocations == 0);
+
+    // Разные классы вместимости не мешают друг другу
+    {
+        SimpleVector<int64_t> ints(100, 7, &pool);
+        SimpleVector<char> tiny(10, 'z', &pool);
+        assert(ints[99] == 7 && tiny[9] == 'z');
+    }
+    for (int i = 0; i < 1000; ++i) {
+        SimpleVector<int64_t> ints(100, 8, &pool);
+        assert(ints[0] == 8);
+    }
+    size_t steady_allocations = heap.allocations;
+
+    // Purge отдаёт всё накопленное обратно
+    pool.Purge();
+    assert(pool.GetCachedBytes() == 0);
+    assert(heap.deallocations == steady_allocations);
+
+    // Пул текущего потока доступен без ручного создания
+    {
+        SimpleVector<char> buffer(256, 'q', &RecyclingMemoryResource::ThisThread());
+        assert(buffer[255] == 'q');
+    }
+    assert(RecyclingMemoryResource::ThisThread().GetCachedBytes() != 0);
+    PurgePools();
+    assert(RecyclingMemoryResource::ThisThread().GetCachedBytes() == 0);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestFromTransform() {
+    cout << "Test fused transform"s << endl;
+    SimpleVector<int> input;
+    for (int i = 0; i < 1000; ++i) {
+        input.PushBack(i);
+    }
+
+    // Выходные элементы конструируются сразу из f(input[i])
+    auto doubled = SimpleVector<int64_t>::FromTransform(input, [](int x) {
+        return static_cast<int64_t>(x) * 2;
+    });
+    assert(doubled.GetSize() == 1000);
+    assert(doubled.GetCapacity() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        assert(doubled[i] == i * 2);
+    }
+
+    // Смена типа элемента: число -> строка
+    auto labels = SimpleVector<string>::FromTransform(input, [](int x) {
+        return to_string(x);
+    });
+    assert(labels[999] == "999"s);
+
+    // Параллельная ветка на крупном входе
+    SimpleVector<double> big_input(300000, 0.5);
+    auto scaled = SimpleVector<double>::FromTransformParallel(
+        big_input, [](double x) noexcept { return x * 4.0; });
+    assert(scaled.GetSize() == 300000);
+    assert(scaled[0] == 2.0 && scaled[299999] == 2.0);
+
+    // Преобразование на месте — без второго буфера
+    input.TransformInPlace([](int x) {
+        return x + 1;
+    });
+    assert(input[0] == 1 && input[999] == 1000);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestFrozenVector() {
+    cout << "Test frozen compressed vector"s << endl;
+    // Историческая серия: длинные участки повторов и немного шума
+    SimpleVector<float> series;
+    for (int i = 0; i < 50000; ++i) {
+        series.PushBack(i % 1000 < 900 ? 1.5f : static_cast<float>(i));
+    }
+    SimpleVector<float> original(series);
+
+    FrozenSimpleVector<float> cold(move(series));
+    assert(!cold.IsFrozen());
+    assert(cold.GetSize() == 50000);
+    assert(cold[123] == original[123]);
+
+    cold.Freeze();
+    assert(cold.IsFrozen());
+    size_t raw_bytes = original.GetSize() * sizeof(float);
+    assert(cold.GetCompressedBytes() != 0);
+    assert(cold.GetCompressedBytes() * 3 < raw_bytes);
+
+    // Произвольный доступ разжимает только затронутый блок
+    for (size_t index : {size_t(0), size_t(777), size_t(25000), size_t(49999)}) {
+        assert(cold[index] == original[index]);
+        assert(cold.At(index) == original[index]);
+    }
+    try {
+        cold.At(50000);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    // Последовательный обход идёт блок за блоком через кэш
+    double cold_sum = 0;
+    for (float value : cold) {
+        cold_sum += value;
+    }
+    double expected_sum = 0;
+    for (float value : original) {
+        expected_sum += value;
+    }
+    assert(cold_sum == expected_sum);
+
+    // Thaw восстанавливает плоский буфер бит в бит
+    cold.Thaw();
+    assert(!cold.IsFrozen());
+    assert(cold.GetCompressedBytes() == 0);
+    for (size_t i = 0; i < original.GetSize(); ++i) {
+        assert(cold[i] == original[i]);
+    }
+
+    // Повторная заморозка после оттаивания
+    cold.Freeze();
+    assert(cold.IsFrozen() && cold[49999] == original[49999]);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestConcurrentVector() {
+    cout << "Test concurrent append"s << endl;
+    const size_t producers = 8;
+    const size_t per_thread = 10000;
+
+    ConcurrentSimpleVector<size_t> concurrent;
+    SimpleVector<thread> threads;
+    threads.Reserve(producers);
+    for (size_t t = 0; t < producers; ++t) {
+        threads.EmplaceBack([&concurrent, t] {
+            for (size_t i = 0; i < per_thread; ++i) {
+                concurrent.PushBack(t * per_thread + i);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    assert(concurrent.GetSize() == producers * per_thread);
+
+    SimpleVector<size_t> merged = concurrent.Consolidate();
+    assert(merged.GetSize() == producers * per_thread);
+    assert(concurrent.GetSize() == 0);
+
+    // Каждое значение встречается ровно один раз
+    SimpleVector<char> seen(producers * per_thread, static_cast<char>(0));
+    for (size_t value : merged) {
+        assert(value < seen.GetSize());
+        assert(seen[value] == 0);
+        seen[value] = 1;
+    }
+
+    // Перемещаемый тип уезжает в итоговый вектор без копий
+    ConcurrentSimpleVector<X> xs(4);
+    xs.EmplaceBack(42);
+    SimpleVector<X> xs_merged = xs.Consolidate();
+    assert(xs_merged.GetSize() == 1 && xs_merged[0].GetX() == 42);
+    cout << "Done!"s << endl << endl;
+}
+
+#ifdef SIMPLE_VECTOR_PROFILE
+// Копируемый тип без nothrow-перемещения: при переезде move_if_noexcept копирует
+struct ThrowOnCopy {
+    ThrowOnCopy() = default;
+    ThrowOnCopy(const ThrowOnCopy&) {
+    }
+    ThrowOnCopy& operator=(const ThrowOnCopy&) {
+        return *this;
+    }
+};
+
+void TestProfileStats() {
+    cout << "Test profile counters"s << endl;
+    auto global_before = GetGlobalSimpleVectorStats();
+
+    SimpleVector<int> v;
+    v.Reserve(4);
+    assert(v.GetStats().allocations == 1);
+    assert(v.GetStats().allocated_bytes == 4 * sizeof(int));
+    assert(v.GetStats().peak_capacity == 4);
+
+    for (int i = 0; i < 5; ++i) {
+        v.PushBack(i);
+    }
+    // Пятый PushBack не влез в вместимость 4 — один переезд четырёх элементов
+    assert(v.GetStats().allocations == 2);
+    assert(v.GetStats().reallocations == 1);
+    assert(v.GetStats().moved_elements == 4);
+    assert(v.GetStats().copied_elements == 0);
+    assert(v.GetStats().peak_capacity == v.GetCapacity());
+
+    // Тип с бросающим перемещением идёт по копирующей ветке move_if_noexcept
+    SimpleVector<ThrowOnCopy> tc;
+    tc.Reserve(2);
+    tc.PushBack(ThrowOnCopy{});
+    tc.PushBack(ThrowOnCopy{});
+    tc.PushBack(ThrowOnCopy{});
+    assert(tc.GetStats().reallocations == 1);
+    assert(tc.GetStats().copied_elements == 2);
+    assert(tc.GetStats().moved_elements == 0);
+
+    // Глобальный агрегат накапливает счётчики всех экземпляров
+    auto& global = GetGlobalSimpleVectorStats();
+    assert(global.allocations >= global_before.allocations + 3);
+    assert(global.reallocations >= global_before.reallocations + 2);
+    cout << "Done!"s << endl << endl;
+}
+#endif
+
 int main() {
     TestTemporaryObjConstructor();
     TestTemporaryObjOperator();
@@ -158,6 +1146,33 @@ int main() {
     TestNoncopiableMoveConstructor();
     TestNoncopiablePushBack();
     TestNoncopiableInsert();
+    TestEmplace();
     TestNoncopiableErase();
+    TestSwapAndPopEraseIf();
+    TestSmallVector();
+    TestAppendRange();
+    TestShrinkToFit();
+    TestMemoryResource();
+    TestParallelFill();
+    TestResizeUninitialized();
+    TestCompare();
+    TestAdoptRelease();
+    TestVectorView();
+    TestConcurrentVector();
+    TestFixedVector();
+    TestCowVector();
+    TestVectorIo();
+    TestHugePageResource();
+    TestSoAVector();
+    TestSegmentedVector();
+    TestIncrementalVector();
+    TestSpanAccess();
+    TestSortedVector();
+    TestRecyclingResource();
+    TestFromTransform();
+    TestFrozenVector();
+#ifdef SIMPLE_VECTOR_PROFILE
+    TestProfileStats();
+#endif
     return 0;
 }
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+// Перерабатывающий ресурс памяти для векторов с высокой оборачиваемостью:
+// освобождённые блоки не возвращаются в кучу, а встают в свободный список
+// своего класса вместимости (размеры округляются к степени двойки)
+// и выдаются следующему запросу того же класса. Обработчик, создающий
+// и разрушающий сотни тысяч SimpleVector<char> в секунду, в установившемся
+// режиме не делает ни одного malloc/free — только снятие и возврат
+// головы списка.
+//
+// Экземпляр не потокобезопасен и рассчитан на схему «ресурс на поток»:
+// ThisThread() возвращает thread-local экземпляр, так что потоки
+// обработчиков не толкаются на общем списке. PurgePools() отдаёт
+// накопленные блоки обратно вышестоящему ресурсу при дефиците памяти.
+//
+// Подключается через конструкторы SimpleVector(resource):
+//     SimpleVector<char> buffer(4096, &RecyclingMemoryResource::ThisThread());
+class RecyclingMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit RecyclingMemoryResource(std::pmr::memory_resource* upstream
+                                         = std::pmr::get_default_resource())
+        : upstream_(upstream) {
+        assert(upstream != nullptr);
+    }
+
+    RecyclingMemoryResource(const RecyclingMemoryResource&) = delete;
+    RecyclingMemoryResource& operator=(const RecyclingMemoryResource&) = delete;
+
+    ~RecyclingMemoryResource() override {
+        Purge();
+    }
+
+    // Возвращает перерабатывающий ресурс текущего потока
+    static RecyclingMemoryResource& ThisThread() {
+        static thread_local RecyclingMemoryResource resource;
+        return resource;
+    }
+
+    // Отдаёт все накопленные блоки вышестоящему ресурсу
+    void Purge() noexcept {
+        for (size_t klass = 0; klass < kClassCount; ++klass) {
+            while (free_lists_[klass] != nullptr) {
+                FreeNode* node = free_lists_[klass];
+                free_lists_[klass] = node->next;
+                upstream_->deallocate(node, ClassBytes(klass), alignof(std::max_align_t));
+            }
+            cached_blocks_[klass] = 0;
+        }
+        cached_bytes_ = 0;
+    }
+
+    // Возвращает объём блоков, ждущих переиспользования
+    size_t GetCachedBytes() const noexcept {
+        return cached_bytes_;
+    }
+
+private:
+    struct FreeNode {
+        FreeNode* next = nullptr;
+    };
+
+    // Классы вместимости: 16 байт .. 1 МБ, шаг — степень двойки.
+    // Запросы крупнее и запросы с нестандартным выравниванием
+    // уходят напрямую в вышестоящий ресурс
+    static constexpr size_t kMinClassBytes = 16;
+    static constexpr size_t kMaxClassBytes = 1 << 20;
+    static constexpr size_t kClassCount = 17;
+    // Потолок на класс: дальше блоки возвращаются в кучу,
+    // чтобы один всплеск не закрепил за пулом лишнюю память
+    static constexpr size_t kMaxBlocksPerClass = 64;
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        if (bytes > kMaxClassBytes || alignment > alignof(std::max_align_t)) {
+            return upstream_->allocate(bytes, alignment);
+        }
+        size_t klass = ClassFor(bytes);
+        if (free_lists_[klass] != nullptr) {
+            FreeNode* node = free_lists_[klass];
+            free_lists_[klass] = node->next;
+            --cached_blocks_[klass];
+            cached_bytes_ -= ClassBytes(klass);
+            return node;
+        }
+        // Блок выделяется сразу размером класса, чтобы при возврате
+        // встать в список без пересчётов
+        return upstream_->allocate(ClassBytes(klass), alignof(std::max_align_t));
+    }
+
+    void do_deallocate(void* block, size_t bytes, size_t alignment) override {
+        if (bytes > kMaxClassBytes || alignment > alignof(std::max_align_t)) {
+            upstream_->deallocate(block, bytes, alignment);
+            return;
+        }
+        size_t klass = ClassFor(bytes);
+        if (cached_blocks_[klass] >= kMaxBlocksPerClass) {
+            upstream_->deallocate(block, ClassBytes(klass), alignof(std::max_align_t));
+            return;
+        }
+        FreeNode* node = new (block) FreeNode{free_lists_[klass]};
+        free_lists_[klass] = node;
+        ++cached_blocks_[klass];
+        cached_bytes_ += ClassBytes(klass);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    // Номер класса вместимости для запроса в bytes байт
+    static size_t ClassFor(size_t bytes) noexcept {
+        size_t klass = 0;
+        while (ClassBytes(klass) < bytes) {
+            ++klass;
+        }
+        return klass;
+    }
+
+    static constexpr size_t ClassBytes(size_t klass) noexcept {
+        return kMinClassBytes << klass;
+    }
+
+    std::pmr::memory_resource* upstream_ = std::pmr::get_default_resource();
+    FreeNode* free_lists_[kClassCount] = {};
+    size_t cached_blocks_[kClassCount] = {};
+    size_t cached_bytes_ = 0;
+};
+
+// Возвращает вышестоящему ресурсу блоки, накопленные пулом текущего потока.
+// Вызывается обработчиком давления памяти
+inline void PurgePools() noexcept {
+    RecyclingMemoryResource::ThisThread().Purge();
+}
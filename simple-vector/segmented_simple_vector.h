@@ -0,0 +1,259 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "array_ptr.h"
+#include "simple_vector.h"
+
+// Сегментированный вектор для нагрузок, где недопустим O(n)-переезд
+// при пересечении границы удвоения: хранилище — цепочка блоков
+// фиксированного размера, рост добавляет новый блок и никогда не трогает
+// уже записанные элементы. Добавление имеет жёстко ограниченную стоимость
+// (максимум — выделение одного блока), ценой деления с маской в operator[].
+//
+// Хребет (список блоков) при росте переезжает сам, но переносятся только
+// указатели на блоки — элементы остаются на месте, поэтому ссылки
+// на элементы переживают любой PushBack. BlockSize — степень двойки,
+// чтобы индекс раскладывался на сдвиг и маску
+template <typename Type, size_t BlockSize = 1024>
+class SegmentedSimpleVector {
+    static_assert(BlockSize != 0 && (BlockSize & (BlockSize - 1)) == 0,
+                  "BlockSize must be a power of two");
+
+public:
+    // Итератор последовательного обхода (forward): хранит номер элемента
+    // и адресуется через хребет, поэтому остаётся валидным при росте
+    template <bool IsConst>
+    class BasicIterator {
+        friend class SegmentedSimpleVector;
+        using Container = std::conditional_t<IsConst,
+                                             const SegmentedSimpleVector,
+                                             SegmentedSimpleVector>;
+
+        BasicIterator(Container* container, size_t index) noexcept
+            : container_(container), index_(index) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const Type*, Type*>;
+        using reference = std::conditional_t<IsConst, const Type&, Type&>;
+
+        BasicIterator() = default;
+
+        // Конвертация итератора в константный итератор
+        BasicIterator(const BasicIterator<false>& other) noexcept
+            : container_(other.container_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return (*container_)[index_];
+        }
+
+        pointer operator->() const noexcept {
+            return &(*container_)[index_];
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old = *this;
+            ++index_;
+            return old;
+        }
+
+        bool operator==(const BasicIterator& rhs) const noexcept {
+            return container_ == rhs.container_ && index_ == rhs.index_;
+        }
+
+        bool operator!=(const BasicIterator& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+    private:
+        template <bool>
+        friend class BasicIterator;
+
+        Container* container_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    SegmentedSimpleVector() noexcept = default;
+
+    // Все блоки выделяются у ресурса resource
+    explicit SegmentedSimpleVector(std::pmr::memory_resource* resource) noexcept
+        : resource_(resource), blocks_(resource) {
+        assert(resource != nullptr);
+    }
+
+    // Создаёт вектор из size элементов со значением по умолчанию
+    explicit SegmentedSimpleVector(size_t size) {
+        Resize(size);
+    }
+
+    SegmentedSimpleVector(SegmentedSimpleVector&& other) noexcept
+        : resource_(other.resource_),
+          blocks_(std::move(other.blocks_)),
+          size_(std::exchange(other.size_, 0)) {
+    }
+
+    // Копирование не поддерживается: контейнер предназначен для буферов,
+    // которые заполняются на месте
+    SegmentedSimpleVector(const SegmentedSimpleVector&) = delete;
+    SegmentedSimpleVector& operator=(const SegmentedSimpleVector&) = delete;
+    SegmentedSimpleVector& operator=(SegmentedSimpleVector&&) = delete;
+
+    ~SegmentedSimpleVector() {
+        DestroyElements(0);
+    }
+
+    // Возвращает количество элементов
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Возвращает вместимость: число блоков, умноженное на размер блока
+    size_t GetCapacity() const noexcept {
+        return blocks_.GetSize() * BlockSize;
+    }
+
+    // Сообщает, пустой ли вектор
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает ссылку на элемент с индексом index
+    Type& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return blocks_[index / BlockSize][index % BlockSize];
+    }
+
+    // Возвращает константную ссылку на элемент с индексом index
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return blocks_[index / BlockSize][index % BlockSize];
+    }
+
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    Type& At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return (*this)[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return (*this)[index];
+    }
+
+    // Добавляет элемент в конец. Существующие элементы не перемещаются,
+    // худший случай — выделение одного блока размера BlockSize
+    void PushBack(const Type& item) {
+        new (SlotForPushBack()) Type(item);
+        ++size_;
+    }
+
+    void PushBack(Type&& item) {
+        new (SlotForPushBack()) Type(std::move(item));
+        ++size_;
+    }
+
+    // Конструирует элемент в конце прямо в хранилище из args
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        Type* slot = SlotForPushBack();
+        new (slot) Type(std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    // Удаляет последний элемент. Пустые хвостовые блоки не освобождаются
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+        std::destroy_at(&(*this)[size_ - 1]);
+        --size_;
+    }
+
+    // Изменяет размер. Новые элементы получают значение по умолчанию
+    void Resize(size_t new_size) {
+        if (new_size < size_) {
+            DestroyElements(new_size);
+            size_ = new_size;
+            return;
+        }
+        while (size_ < new_size) {
+            new (SlotForPushBack()) Type();
+            ++size_;
+        }
+    }
+
+    // Разрушает все элементы. Блоки остаются за вектором
+    void Clear() noexcept {
+        DestroyElements(0);
+        size_ = 0;
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, size_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    // Возвращает сырую ячейку под следующий элемент,
+    // при необходимости добавляя блок в хребет
+    Type* SlotForPushBack() {
+        if (size_ == GetCapacity()) {
+            blocks_.PushBack(RawArrayPtr<Type>(BlockSize, resource_));
+        }
+        return blocks_[size_ / BlockSize].Get() + size_ % BlockSize;
+    }
+
+    // Разрушает элементы с номерами [from, size_)
+    void DestroyElements(size_t from) noexcept {
+        for (size_t i = from; i < size_; ++i) {
+            std::destroy_at(&blocks_[i / BlockSize][i % BlockSize]);
+        }
+    }
+
+    std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+    SimpleVector<RawArrayPtr<Type>> blocks_;
+    size_t size_ = 0;
+};
@@ -1,8 +1,17 @@
 #pragma once
 
 #include <cassert>
+#include <cstring>
+#if defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907L
+#include <compare>
+#endif
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
 #include <utility>
 
 #include "array_ptr.h"
@@ -27,6 +36,81 @@ ReserveProxyObj Reserve(size_t capacity_to_reserve) {
     return ReserveProxyObj(capacity_to_reserve);
 }
 
+#ifdef SIMPLE_VECTOR_PROFILE
+// Счётчики горячего пути: выделения памяти, переезды в новый блок и объём
+// перенесённых при этом элементов. Доступны только в сборке с
+// -DSIMPLE_VECTOR_PROFILE; в обычной сборке ни счётчиков, ни кода нет.
+// Счётчики не атомарные — флаг предназначен для профилировочных прогонов
+struct SimpleVectorStats {
+    size_t allocations = 0;      // число выделений блоков памяти
+    size_t allocated_bytes = 0;  // суммарный объём выделений в байтах
+    size_t reallocations = 0;    // число переездов живых элементов в новый блок
+    size_t moved_elements = 0;   // элементов перемещено при переездах
+    size_t copied_elements = 0;  // элементов скопировано при переездах
+    size_t peak_capacity = 0;    // максимальная вместимость в элементах
+};
+
+// Глобальный агрегат по всем экземплярам SimpleVector — для экспорта в метрики
+inline SimpleVectorStats& GetGlobalSimpleVectorStats() noexcept {
+    static SimpleVectorStats stats;
+    return stats;
+}
+#endif
+
+// Невладеющее представление непрерывного диапазона элементов.
+// В отладочной сборке каждое обращение проверяет границы через assert;
+// с -DNDEBUG проверки исчезают и остаётся голая пара указатель/размер,
+// так что горячие циклы векторизуются как по сырому массиву.
+// Один и тот же код работает проверяемым в канареечных сборках
+// и бесплатным в боевых
+template <typename Type>
+class SimpleVectorSpan {
+public:
+    using Iterator = Type*;
+
+    SimpleVectorSpan() = default;
+
+    SimpleVectorSpan(Type* data, size_t size) noexcept
+        : data_(data), size_(size) {
+    }
+
+    // Возвращает количество элементов в диапазоне
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустой ли диапазон
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает ссылку на элемент с индексом index.
+    // В отладочной сборке выход за границы ловится assert
+    Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    // Возвращает поддиапазон из count элементов начиная с offset
+    SimpleVectorSpan Subspan(size_t offset, size_t count) const noexcept {
+        assert(offset <= size_);
+        assert(count <= size_ - offset);
+        return SimpleVectorSpan(data_ + offset, count);
+    }
+
+    Iterator begin() const noexcept {
+        return data_;
+    }
+
+    Iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+private:
+    Type* data_ = nullptr;
+    size_t size_ = 0;
+};
+
 template <typename Type>
 class SimpleVector {
 public:
@@ -35,36 +119,57 @@ public:
 
     SimpleVector() noexcept = default;
 
-    // Создаёт вектор из size элементов, инициализированных значением по умолчанию
-    explicit SimpleVector(size_t size) : items_(size) {
+    // Создаёт пустой вектор, который будет выделять память у ресурса resource
+    explicit SimpleVector(std::pmr::memory_resource* resource) noexcept
+        : resource_(resource) {
+        assert(resource != nullptr);
+    }
+
+    // Создаёт вектор из size элементов, инициализированных значением по умолчанию.
+    // Конструируются только size элементов, остальная память остаётся сырой
+    explicit SimpleVector(size_t size)
+        : SimpleVector(size, std::pmr::get_default_resource()) {
+    }
+
+    SimpleVector(size_t size, std::pmr::memory_resource* resource)
+        : resource_(resource), items_(size, resource) {
+        ProfileAllocation(size);
+        ValueConstructRange(items_.Get(), size);
         size_ = size;
         capacity_ = size;
-        //std::fill(begin(), end(), Type());
-        std::generate(begin(), end(), []() { return Type(); });
     }
 
     // Создаёт вектор из size элементов, инициализированных значением value
-    SimpleVector(size_t size, const Type& value) : items_(size) {
+    SimpleVector(size_t size, const Type& value)
+        : SimpleVector(size, value, std::pmr::get_default_resource()) {
+    }
+
+    SimpleVector(size_t size, const Type& value, std::pmr::memory_resource* resource)
+        : resource_(resource), items_(size, resource) {
+        ProfileAllocation(size);
+        std::uninitialized_fill_n(items_.Get(), size, value);
         size_ = size;
         capacity_ = size;
-        std::fill(begin(), end(), value);
     }
 
     // Создаёт вектор из std::initializer_list
     SimpleVector(std::initializer_list<Type> init) : items_(init.size()) {
+        ProfileAllocation(init.size());
+        RelocateCopy(init.begin(), init.size(), items_.Get());
         size_ = init.size();
         capacity_ = init.size();
-        std::copy(init.begin(), init.end(), begin());
     }
 
     SimpleVector(const SimpleVector& other) : items_(other.GetSize()) {
+        ProfileAllocation(other.GetSize());
+        RelocateCopy(other.begin(), other.GetSize(), items_.Get());
         size_ = other.GetSize();
-        capacity_ = other.GetCapacity();
-        std::copy(other.begin(), other.end(), begin());
+        capacity_ = other.GetSize();
     }
 
     SimpleVector(SimpleVector&& other)
     {
+        resource_ = other.resource_;
         items_ = std::move(other.items_);
         size_ = std::exchange(other.size_, 0);
         capacity_ = std::exchange(other.capacity_, 0);
@@ -74,6 +179,177 @@ public:
         Reserve(capacity_to_reserve.ReserveCapasity());
     }
 
+    // Создаёт вектор из size элементов со значением value, заполняя буфер
+    // несколькими потоками. Небольшие векторы заполняются последовательно.
+    // Тип должен копироваться без исключений: откатить заполнение,
+    // упавшее в другом потоке, невозможно
+    static SimpleVector FilledParallel(size_t size, const Type& value,
+                                       std::pmr::memory_resource* resource
+                                           = std::pmr::get_default_resource()) {
+        static_assert(std::is_nothrow_copy_constructible_v<Type>,
+                      "FilledParallel requires a nothrow copy constructor");
+
+        SimpleVector result(resource);
+        result.items_ = RawArrayPtr<Type>(size, resource);
+        result.capacity_ = size;
+        result.ProfileAllocation(size);
+
+        size_t workers = std::thread::hardware_concurrency();
+        if (size < kParallelFillMinSize || workers < 2) {
+            std::uninitialized_fill_n(result.items_.Get(), size, value);
+            result.size_ = size;
+            return result;
+        }
+
+        size_t chunk = (size + workers - 1) / workers;
+        SimpleVector<std::thread> threads;
+        threads.Reserve(workers);
+        for (size_t from = 0; from < size; from += chunk) {
+            size_t count = std::min(chunk, size - from);
+            threads.EmplaceBack([first = result.items_.Get() + from, count, &value] {
+                std::uninitialized_fill_n(first, count, value);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        result.size_ = size;
+        return result;
+    }
+
+    // То же, но каждый элемент i конструируется из generator(i)
+    template <typename Generator>
+    static SimpleVector GeneratedParallel(size_t size, Generator generator,
+                                          std::pmr::memory_resource* resource
+                                              = std::pmr::get_default_resource()) {
+        static_assert(std::is_nothrow_constructible_v<
+                          Type, decltype(generator(size_t{}))>,
+                      "GeneratedParallel requires nothrow construction from generator result");
+
+        SimpleVector result(resource);
+        result.items_ = RawArrayPtr<Type>(size, resource);
+        result.capacity_ = size;
+        result.ProfileAllocation(size);
+
+        auto fill_range = [&generator, &result](size_t from, size_t count) {
+            Type* cur = result.items_.Get() + from;
+            for (size_t i = 0; i < count; ++i, ++cur) {
+                new (cur) Type(generator(from + i));
+            }
+        };
+
+        size_t workers = std::thread::hardware_concurrency();
+        if (size < kParallelFillMinSize || workers < 2) {
+            fill_range(0, size);
+            result.size_ = size;
+            return result;
+        }
+
+        size_t chunk = (size + workers - 1) / workers;
+        SimpleVector<std::thread> threads;
+        threads.Reserve(workers);
+        for (size_t from = 0; from < size; from += chunk) {
+            size_t count = std::min(chunk, size - from);
+            threads.EmplaceBack([fill_range, from, count] {
+                fill_range(from, count);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        result.size_ = size;
+        return result;
+    }
+
+    // Создаёт вектор из op(input[i]) для каждого элемента input.
+    // Каждый выходной элемент конструируется сразу из результата op —
+    // без прохода конструктора по умолчанию и присваивания поверх,
+    // то есть вдвое меньше трафика памяти, чем у Resize + цикла
+    template <typename Source, typename Operation>
+    static SimpleVector FromTransform(const SimpleVector<Source>& input, Operation op,
+                                      std::pmr::memory_resource* resource
+                                          = std::pmr::get_default_resource()) {
+        size_t size = input.GetSize();
+        SimpleVector result(resource);
+        result.items_ = RawArrayPtr<Type>(size, resource);
+        result.capacity_ = size;
+        result.ProfileAllocation(size);
+
+        Type* cur = result.items_.Get();
+        try {
+            for (size_t i = 0; i < size; ++i, ++cur) {
+                new (cur) Type(op(input[i]));
+            }
+        }
+        catch (...) {
+            std::destroy(result.items_.Get(), cur);
+            throw;
+        }
+        result.size_ = size;
+        return result;
+    }
+
+    // То же, но крупные входы обрабатываются несколькими потоками.
+    // Операция не должна бросать исключений — как у GeneratedParallel,
+    // через который и выполняется разбиение на диапазоны
+    template <typename Source, typename Operation>
+    static SimpleVector FromTransformParallel(const SimpleVector<Source>& input, Operation op,
+                                              std::pmr::memory_resource* resource
+                                                  = std::pmr::get_default_resource()) {
+        return GeneratedParallel(
+            input.GetSize(),
+            [&input, &op](size_t i) noexcept { return op(input[i]); },
+            resource);
+    }
+
+    // Заменяет каждый элемент на op(элемент) за один проход
+    template <typename Operation>
+    void TransformInPlace(Operation op) {
+        for (size_t i = 0; i < size_; ++i) {
+            items_[i] = op(items_[i]);
+        }
+    }
+
+    // Описание буфера, отданного вектором через ReleaseBuffer
+    struct ReleasedBuffer {
+        Type* data = nullptr;
+        size_t size = 0;
+        size_t capacity = 0;
+        std::pmr::memory_resource* resource = nullptr;
+    };
+
+    // Принимает внешний буфер без копирования. Первые size элементов должны
+    // быть сконструированы. Буфер должен быть выделен у resource блоком
+    // capacity * sizeof(Type) байт с выравниванием alignof(Type) — ровно так
+    // вектор освободит его (или вернёт через ReleaseBuffer)
+    static SimpleVector Adopt(Type* buf, size_t size, size_t capacity,
+                              std::pmr::memory_resource* resource
+                                  = std::pmr::get_default_resource()) {
+        assert(size <= capacity);
+        SimpleVector result(resource);
+        result.items_ = RawArrayPtr<Type>(buf, capacity, resource);
+        result.size_ = size;
+        result.capacity_ = capacity;
+        return result;
+    }
+
+    // Прекращает владение буфером и отдаёт его вызывающему вместе с ресурсом,
+    // у которого тот был выделен. Элементы не разрушаются; вектор пустеет
+    [[nodiscard]] ReleasedBuffer ReleaseBuffer() noexcept {
+        ReleasedBuffer released;
+        released.size = std::exchange(size_, 0);
+        released.capacity = capacity_;
+        released.resource = items_.GetMemoryResource();
+        capacity_ = 0;
+        released.data = items_.Release();
+        return released;
+    }
+
+    // Разрушает только живые элементы, память освобождает RawArrayPtr
+    ~SimpleVector() {
+        std::destroy(begin(), end());
+    }
+
     // Возвращает количество элементов в массиве
     size_t GetSize() const noexcept {
         return size_;
@@ -84,6 +360,18 @@ public:
         return capacity_;
     }
 
+    // Возвращает ресурс памяти, у которого вектор выделяет хранилище
+    std::pmr::memory_resource* GetMemoryResource() const noexcept {
+        return resource_;
+    }
+
+#ifdef SIMPLE_VECTOR_PROFILE
+    // Возвращает счётчики этого экземпляра (сборка с -DSIMPLE_VECTOR_PROFILE)
+    const SimpleVectorStats& GetStats() const noexcept {
+        return stats_;
+    }
+#endif
+
     // Сообщает, пустой ли массив
     bool IsEmpty() const noexcept {
         return size_ == 0;
@@ -119,8 +407,31 @@ public:
         return items_[index];
     }
 
+    // Доступ без каких-либо проверок — даже assert отсутствует.
+    // Контракт: index < GetSize(), за нарушение отвечает вызывающий.
+    // Имя явно помечает небезопасные обращения в горячих циклах
+    Type& UncheckedAt(size_t index) noexcept {
+        return items_[index];
+    }
+
+    const Type& UncheckedAt(size_t index) const noexcept {
+        return items_[index];
+    }
+
+    // Возвращает представление живых элементов: в отладочной сборке
+    // каждое обращение проверяет границы, в боевой — это сырой указатель.
+    // Представление инвалидируется любой операцией, меняющей вместимость
+    SimpleVectorSpan<Type> AsSpan() noexcept {
+        return SimpleVectorSpan<Type>(items_.Get(), size_);
+    }
+
+    SimpleVectorSpan<const Type> AsSpan() const noexcept {
+        return SimpleVectorSpan<const Type>(items_.Get(), size_);
+    }
+
     // Обнуляет размер массива, не изменяя его вместимость
     void Clear() noexcept {
+        std::destroy(begin(), end());
         size_ = 0;
     }
 
@@ -130,25 +441,50 @@ public:
         if (new_size == size_) return;
 
         if (new_size < size_) {
-            for (auto it = &items_[new_size]; it != &items_[size_]; ++it) {
-                *(it) = std::move(Type{});
-            }
+            std::destroy(items_.Get() + new_size, items_.Get() + size_);
         }
+        else if (new_size <= capacity_) {
+            ValueConstructRange(items_.Get() + size_, new_size - size_);
+        }
+        else {
+            auto new_capacity = CalculateGrowth(new_size);
+            GrowWith(new_capacity, size_, new_size - size_, [count = new_size - size_](Type* slot) {
+                ValueConstructRange(slot, count);
+            });
+        }
+
+        size_ = new_size;
+    }
 
+    // Изменяет размер массива, не инициализируя новые элементы — их байты
+    // содержат мусор, вызывающий обязан перезаписать их до чтения.
+    // Только для тривиальных типов (приёмные буферы ввода-вывода и т.п.)
+    void ResizeUninitialized(size_t new_size) {
+        static_assert(std::is_trivially_default_constructible_v<Type>
+                          && std::is_trivially_destructible_v<Type>,
+                      "ResizeUninitialized requires a trivial element type");
         if (new_size > capacity_) {
-            auto new_capacity = std::max(new_size, 2 * capacity_);
-            ArrayPtr<Type> arr_ptr(new_capacity);
-            std::move(&items_[0], &items_[size_], &arr_ptr[0]);
-            for (auto it = &arr_ptr[size_]; it != &arr_ptr[new_size]; ++it) {
-                *(it) = std::move(Type{});
-            }
-            items_.swap(arr_ptr);
-            capacity_ = new_capacity;
+            Reallocate(CalculateGrowth(new_size));
         }
-
         size_ = new_size;
     }
 
+    // В стиле C++23 std::string::resize_and_overwrite: обеспечивает буфер
+    // под new_size элементов, вызывает op(data, new_size) и принимает
+    // возвращённое из op фактическое число заполненных элементов
+    template <typename Operation>
+    void ResizeAndOverwrite(size_t new_size, Operation op) {
+        static_assert(std::is_trivially_default_constructible_v<Type>
+                          && std::is_trivially_destructible_v<Type>,
+                      "ResizeAndOverwrite requires a trivial element type");
+        if (new_size > capacity_) {
+            Reallocate(CalculateGrowth(new_size));
+        }
+        auto filled = static_cast<size_t>(op(items_.Get(), new_size));
+        assert(filled <= new_size);
+        size_ = filled;
+    }
+
     // Возвращает итератор на начало массива
     // Для пустого массива может быть равен (или не равен) nullptr
     Iterator begin() noexcept {
@@ -197,35 +533,79 @@ public:
     // При нехватке места увеличивает вдвое вместимость вектора
     void PushBack(const Type& item) {
         if (size_ < capacity_) {
-            items_[size_] = item;
+            new (items_.Get() + size_) Type(item);
         }
         else {
-            size_t new_capacity = std::max(size_t(1), 2 * capacity_); //защита, если capacity_=0
-            ArrayPtr<Type> arr_ptr(new_capacity);
-            std::copy(&items_[0], &items_[size_], &arr_ptr[0]);
-            arr_ptr[size_] = item;
-            items_.swap(arr_ptr);
-            capacity_ = new_capacity;
+            size_t new_capacity = CalculateGrowth(size_ + 1);
+            GrowWith(new_capacity, size_, 1, [&item](Type* slot) {
+                new (slot) Type(item);
+            });
         }
         ++size_;
     }
 
     void PushBack(Type&& item) {
         if (size_ < capacity_) {
-            items_[size_] = std::move(item);
+            new (items_.Get() + size_) Type(std::move(item));
         }
         else {
-            size_t new_capacity = std::max(size_t(1), 2 * capacity_); //защита, если capacity_=0
-            ArrayPtr<Type> arr_ptr(new_capacity);
-            std::move(&items_[0], &items_[size_], &arr_ptr[0]);
-            arr_ptr[size_] = std::move(item);
-            items_.swap(arr_ptr);
-            capacity_ = new_capacity;
+            size_t new_capacity = CalculateGrowth(size_ + 1);
+            GrowWith(new_capacity, size_, 1, [&item](Type* slot) {
+                new (slot) Type(std::move(item));
+            });
         }
         ++size_;
     }
 
 
+    // Конструирует элемент в конце вектора прямо в хранилище из args,
+    // без создания временного объекта. Возвращает ссылку на новый элемент
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        if (size_ < capacity_) {
+            new (items_.Get() + size_) Type(std::forward<Args>(args)...);
+        }
+        else {
+            size_t new_capacity = CalculateGrowth(size_ + 1);
+            // Сначала конструируется новый элемент: args могут ссылаться
+            // на элементы этого же вектора
+            GrowWith(new_capacity, size_, 1, [&](Type* slot) {
+                new (slot) Type(std::forward<Args>(args)...);
+            });
+        }
+        ++size_;
+        return items_[size_ - 1];
+    }
+
+    // Конструирует элемент в позиции pos из args. Возвращает итератор на него
+    template <typename... Args>
+    Iterator Emplace(ConstIterator pos, Args&&... args) {
+        assert(pos >= cbegin() && pos <= cend());
+
+        auto pos_element = std::distance(cbegin(), pos);
+
+        if (size_ < capacity_) {
+            if (pos_element == static_cast<std::ptrdiff_t>(size_)) {
+                new (items_.Get() + size_) Type(std::forward<Args>(args)...);
+            }
+            else {
+                Type tmp(std::forward<Args>(args)...);
+                new (items_.Get() + size_) Type(std::move(items_[size_ - 1]));
+                ShiftRight(begin() + pos_element, end() - 1, end());
+                items_[pos_element] = std::move(tmp);
+            }
+        }
+        else {
+            auto new_capacity = CalculateGrowth(size_ + 1);
+            GrowWith(new_capacity, pos_element, 1, [&](Type* slot) {
+                new (slot) Type(std::forward<Args>(args)...);
+            });
+        }
+
+        ++size_;
+        return Iterator{ &items_[pos_element] };
+    }
+
     // Вставляет значение value в позицию pos.
     // Возвращает итератор на вставленное значение
     // Если перед вставкой значения вектор был заполнен полностью,
@@ -236,17 +616,21 @@ public:
         auto pos_element = std::distance(cbegin(), pos);
 
         if (size_ < capacity_) {
-            std::copy_backward(pos, cend(), &items_[(size_ + 1)]);
-            items_[pos_element] = value;
+            if (pos_element == static_cast<std::ptrdiff_t>(size_)) {
+                new (items_.Get() + size_) Type(value);
+            }
+            else {
+                // Последний элемент уезжает в сырую ячейку, остальной хвост сдвигается
+                new (items_.Get() + size_) Type(std::move(items_[size_ - 1]));
+                ShiftRight(begin() + pos_element, end() - 1, end());
+                items_[pos_element] = value;
+            }
         }
         else {
-            size_t new_capacity = std::max(size_t(1), 2 * capacity_); //защита, если capacity_=0
-            ArrayPtr<Type> arr_ptr(new_capacity);
-            std::copy(&items_[0], &items_[pos_element], &arr_ptr[0]);
-            std::copy_backward(pos, cend(), &arr_ptr[(size_ + 1)]);
-            arr_ptr[pos_element] = value;
-            items_.swap(arr_ptr);
-            capacity_ = new_capacity;
+            size_t new_capacity = CalculateGrowth(size_ + 1);
+            GrowWith(new_capacity, pos_element, 1, [&value](Type* slot) {
+                new (slot) Type(value);
+            });
         }
 
         ++size_;
@@ -260,42 +644,166 @@ public:
         auto pos_element = std::distance(begin(), no_const_pos);
 
         if (size_ < capacity_) {
-            std::move_backward(no_const_pos, end(), &items_[(size_ + 1)]);
-            items_[pos_element] = std::move(value);
+            if (pos_element == static_cast<std::ptrdiff_t>(size_)) {
+                new (items_.Get() + size_) Type(std::move(value));
+            }
+            else {
+                new (items_.Get() + size_) Type(std::move(items_[size_ - 1]));
+                ShiftRight(begin() + pos_element, end() - 1, end());
+                items_[pos_element] = std::move(value);
+            }
         }
         else {
-            auto new_capacity = std::max(size_t(1), 2 * capacity_); //защита, если capacity_=0
-            ArrayPtr<Type> arr_ptr(new_capacity);
-            std::move(&items_[0], &items_[pos_element], &arr_ptr[0]);
-            std::move_backward(no_const_pos, end(), &arr_ptr[(size_ + 1)]);
-            arr_ptr[pos_element] = std::move(value);
-            items_.swap(arr_ptr);
-            capacity_ = new_capacity;
+            auto new_capacity = CalculateGrowth(size_ + 1);
+            GrowWith(new_capacity, pos_element, 1, [&value](Type* slot) {
+                new (slot) Type(std::move(value));
+            });
         }
 
         ++size_;
         return Iterator{ &items_[pos_element] };
     }
 
+    // Добавляет элементы диапазона [first, last) в конец вектора.
+    // Требуемая вместимость считается заранее, память выделяется не более одного раза
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    void AppendRange(It first, It last) {
+        auto count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0) {
+            return;
+        }
+        if (size_ + count > capacity_) {
+            Reallocate(CalculateGrowth(size_ + count));
+        }
+        std::uninitialized_copy(first, last, items_.Get() + size_);
+        size_ += count;
+    }
+
+    // Вставляет элементы диапазона [first, last) перед позицией pos.
+    // Возвращает итератор на первый вставленный элемент.
+    // Память выделяется не более одного раза
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    Iterator Insert(ConstIterator pos, It first, It last) {
+        assert(pos >= cbegin() && pos <= cend());
+
+        auto pos_element = static_cast<size_t>(std::distance(cbegin(), pos));
+        auto count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0) {
+            return begin() + pos_element;
+        }
+
+        if (size_ + count <= capacity_) {
+            size_t tail = size_ - pos_element;
+            if (tail > count) {
+                // Последние count элементов уезжают в сырой хвост,
+                // остаток сдвигается, диапазон присваивается поверх
+                RelocateMove(items_.Get() + size_ - count, count, items_.Get() + size_);
+                ShiftRight(begin() + pos_element, end() - count, end());
+                std::copy(first, last, begin() + pos_element);
+            }
+            else {
+                RelocateMove(items_.Get() + pos_element, tail, items_.Get() + pos_element + count);
+                auto mid = first;
+                std::advance(mid, tail);
+                std::copy(first, mid, begin() + pos_element);
+                std::uninitialized_copy(mid, last, items_.Get() + size_);
+            }
+        }
+        else {
+            auto new_capacity = CalculateGrowth(size_ + count);
+            GrowWith(new_capacity, pos_element, count, [&first, &last](Type* slot) {
+                std::uninitialized_copy(first, last, slot);
+            });
+        }
+
+        size_ += count;
+        return begin() + pos_element;
+    }
+
+    // Переносит элементы move_if_noexcept: типы с nothrow-перемещением
+    // не копируются, типы с бросающим перемещением сохраняют строгую гарантию
     void Reserve(size_t new_capacity) {
         if (new_capacity <= capacity_) {
             return;
         }
+        Reallocate(new_capacity);
+    }
 
-        ArrayPtr<Type> tmp_items(new_capacity);
-        for (std::size_t i{}; i < size_; ++i) {
-            tmp_items[i] = items_[i];
+    // Уменьшает вместимость до текущего размера.
+    // Пустой вектор полностью отдаёт свой блок памяти
+    void ShrinkToFit() {
+        if (capacity_ == size_) {
+            return;
         }
-        items_.swap(tmp_items);
-        capacity_ = new_capacity;
+        if (size_ == 0) {
+            RawArrayPtr<Type> empty;
+            items_.swap(empty);
+            capacity_ = 0;
+            return;
+        }
+        Reallocate(size_);
+    }
+
+    // Уменьшает вместимость, только если доля живых элементов
+    // упала ниже порога, заданного SetShrinkThreshold
+    void MaybeShrinkToFit() {
+        if (shrink_threshold_ > 0.0 &&
+            static_cast<double>(size_) < static_cast<double>(capacity_) * shrink_threshold_) {
+            ShrinkToFit();
+        }
+    }
+
+    // Задаёт коэффициент роста вместимости (по умолчанию 2.0).
+    // Долгоживущие таблицы могут работать на 1.5, временные буферы — на 2.0
+    void SetGrowthFactor(double factor) {
+        assert(factor > 1.0);
+        growth_factor_ = factor;
+    }
+
+    // Задаёт порог доли живых элементов для MaybeShrinkToFit.
+    // 0 (по умолчанию) — автоматическое сжатие выключено
+    void SetShrinkThreshold(double threshold) {
+        assert(threshold >= 0.0 && threshold <= 1.0);
+        shrink_threshold_ = threshold;
     }
 
-    // "Удаляет" последний элемент вектора. Вектор не должен быть пустым
+    // Удаляет последний элемент вектора за O(1). Вектор не должен быть пустым
     void PopBack() noexcept {
         assert(!IsEmpty());
-        auto it_pop = begin();
-        std::advance(it_pop, size_ - 1);
-        Erase(it_pop);
+        std::destroy_at(items_.Get() + size_ - 1);
+        --size_;
+    }
+
+    // Удаляет элемент в позиции pos за O(1), не сохраняя порядок:
+    // на его место встаёт последний элемент. Возвращает итератор на позицию pos
+    Iterator SwapAndPop(ConstIterator pos) {
+        assert(pos >= cbegin() && pos < cend());
+        auto pos_element = std::distance(cbegin(), pos);
+        if (pos_element != static_cast<std::ptrdiff_t>(size_ - 1)) {
+            items_[pos_element] = std::move(items_[size_ - 1]);
+        }
+        std::destroy_at(items_.Get() + size_ - 1);
+        --size_;
+        return items_.Get() + pos_element;
+    }
+
+    // Удаляет все элементы, для которых pred(элемент) == true, одним
+    // уплотняющим проходом вместо N сдвигов хвоста. Возвращает число удалённых
+    template <typename Pred>
+    size_t EraseIf(Pred pred) {
+        Type* write = begin();
+        for (Type* read = begin(); read != end(); ++read) {
+            if (!pred(*read)) {
+                if (write != read) {
+                    *write = std::move(*read);
+                }
+                ++write;
+            }
+        }
+        auto removed = static_cast<size_t>(end() - write);
+        std::destroy(write, end());
+        size_ -= removed;
+        return removed;
     }
 
     // Удаляет элемент вектора в указанной позиции
@@ -303,28 +811,238 @@ public:
         assert(pos >= cbegin() && pos < cend());
         auto no_const_pos = const_cast<Iterator>(pos);
         auto pos_element = std::distance(begin(), no_const_pos);
-        std::move(++no_const_pos, end(), &items_[pos_element]);
+        ShiftLeft(++no_const_pos, end(), items_.Get() + pos_element);
+        std::destroy_at(items_.Get() + size_ - 1);
         --size_;
-        return &items_[pos_element];
+        return items_.Get() + pos_element;
+    }
+
+    // Сравнивает векторы лексикографически за один проход.
+    // Возвращает отрицательное число, ноль или положительное число,
+    // если вектор меньше, равен или больше other.
+    // Для однобайтовых беззнаковых типов сравнение выполняется одним memcmp
+    int Compare(const SimpleVector& other) const {
+        size_t common = std::min(size_, other.size_);
+        if constexpr (sizeof(Type) == 1 && std::is_unsigned_v<Type>) {
+            // Для байтовых типов порядок байтов совпадает с порядком значений,
+            // а memcmp в libc векторизован
+            if (common != 0) {
+                int cmp = std::memcmp(items_.Get(), other.items_.Get(), common);
+                if (cmp != 0) {
+                    return cmp;
+                }
+            }
+        }
+        else {
+            for (size_t i = 0; i < common; ++i) {
+                if (items_[i] < other.items_[i]) {
+                    return -1;
+                }
+                if (other.items_[i] < items_[i]) {
+                    return 1;
+                }
+            }
+        }
+        return size_ < other.size_ ? -1 : (other.size_ < size_ ? 1 : 0);
     }
 
-    // Обменивает значение с другим вектором
+    // Обменивает значение с другим вектором, включая ресурс памяти
     void swap(SimpleVector& other) noexcept {
         items_.swap(other.items_);
         std::swap(size_, other.size_);
         std::swap(capacity_, other.capacity_);
+        std::swap(resource_, other.resource_);
+        std::swap(growth_factor_, other.growth_factor_);
+        std::swap(shrink_threshold_, other.shrink_threshold_);
     }
 
 private:
+    // Ниже этого размера параллельное заполнение не окупает запуск потоков
+    static constexpr size_t kParallelFillMinSize = 64 * 1024;
+
+#ifdef SIMPLE_VECTOR_PROFILE
+    // Учитывает выделение блока под capacity элементов
+    void ProfileAllocation(size_t capacity) noexcept {
+        if (capacity == 0) {
+            return;
+        }
+        auto bytes = capacity * sizeof(Type);
+        auto& global = GetGlobalSimpleVectorStats();
+        stats_.allocations += 1;
+        global.allocations += 1;
+        stats_.allocated_bytes += bytes;
+        global.allocated_bytes += bytes;
+        stats_.peak_capacity = std::max(stats_.peak_capacity, capacity);
+        global.peak_capacity = std::max(global.peak_capacity, capacity);
+    }
+
+    // Учитывает переезд relocated живых элементов в новый блок.
+    // Перемещение или копирование определяется на этапе компиляции —
+    // той же веткой, что выбирает move_if_noexcept в RelocateMove
+    void ProfileReallocation(size_t relocated) noexcept {
+        auto& global = GetGlobalSimpleVectorStats();
+        stats_.reallocations += 1;
+        global.reallocations += 1;
+        if constexpr (std::is_trivially_copyable_v<Type>
+                      || std::is_nothrow_move_constructible_v<Type>
+                      || !std::is_copy_constructible_v<Type>) {
+            stats_.moved_elements += relocated;
+            global.moved_elements += relocated;
+        }
+        else {
+            stats_.copied_elements += relocated;
+            global.copied_elements += relocated;
+        }
+    }
+#else
+    // В обычной сборке профилирование выключено полностью:
+    // пустые заглушки встраиваются в ничто, счётчиков в объекте нет
+    static void ProfileAllocation(size_t) noexcept {}
+    static void ProfileReallocation(size_t) noexcept {}
+#endif
+
+    // Считает новую вместимость: рост в growth_factor_ раз,
+    // но не меньше required (required >= 1 защищает от capacity_ == 0)
+    size_t CalculateGrowth(size_t required) const noexcept {
+        return std::max(required, static_cast<size_t>(static_cast<double>(capacity_) * growth_factor_));
+    }
+
+    // Переносит живые элементы в новый блок вместимостью new_capacity
+    void Reallocate(size_t new_capacity) {
+        GrowWith(new_capacity, size_, 0, [](Type*) {});
+    }
+
+    // Общий путь роста: выделяет блок new_capacity, конструирует в нём count
+    // вставляемых элементов по смещению pos через construct, затем переносит
+    // старые элементы move_if_noexcept. Если что-то бросило — всё
+    // сконструированное в новом блоке разрушается, вектор остаётся прежним
+    template <typename ConstructFn>
+    void GrowWith(size_t new_capacity, size_t pos, size_t count, ConstructFn construct) {
+        RawArrayPtr<Type> arr_ptr(new_capacity, resource_);
+        construct(arr_ptr.Get() + pos);
+        try {
+            RelocateMove(items_.Get(), pos, arr_ptr.Get());
+            try {
+                RelocateMove(items_.Get() + pos, size_ - pos, arr_ptr.Get() + pos + count);
+            }
+            catch (...) {
+                std::destroy(arr_ptr.Get(), arr_ptr.Get() + pos);
+                throw;
+            }
+        }
+        catch (...) {
+            std::destroy(arr_ptr.Get() + pos, arr_ptr.Get() + pos + count);
+            throw;
+        }
+        ProfileAllocation(new_capacity);
+        // Первое выделение блока переездом не считается
+        if (capacity_ != 0) {
+            ProfileReallocation(size_);
+        }
+        std::destroy(begin(), end());
+        items_.swap(arr_ptr);
+        capacity_ = new_capacity;
+    }
 
-    ArrayPtr<Type> items_;
+    // Переносит count элементов из first в сырую память dest.
+    // Для тривиально копируемых типов memcpy вместо поэлементного переноса.
+    // Иначе — move_if_noexcept: бросающее перемещение заменяется копированием,
+    // чтобы при исключении исходные элементы остались нетронутыми
+    static void RelocateMove(Type* first, size_t count, Type* dest) {
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            if (count != 0) {
+                std::memcpy(static_cast<void*>(dest), first, count * sizeof(Type));
+            }
+        }
+        else {
+            Type* cur = dest;
+            try {
+                for (size_t i = 0; i < count; ++i, ++cur) {
+                    new (cur) Type(std::move_if_noexcept(first[i]));
+                }
+            }
+            catch (...) {
+                std::destroy(dest, cur);
+                throw;
+            }
+        }
+    }
+
+    // Копирует count элементов из first в сырую память dest
+    static void RelocateCopy(const Type* first, size_t count, Type* dest) {
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            if (count != 0) {
+                std::memcpy(static_cast<void*>(dest), first, count * sizeof(Type));
+            }
+        }
+        else {
+            std::uninitialized_copy(first, first + count, dest);
+        }
+    }
+
+    // Конструирует count элементов со значением по умолчанию в сырой памяти first.
+    // Для тривиальных типов значение по умолчанию — нулевые байты, поэтому memset
+    static void ValueConstructRange(Type* first, size_t count) {
+        if constexpr (std::is_trivial_v<Type>) {
+            if (count != 0) {
+                std::memset(static_cast<void*>(first), 0, count * sizeof(Type));
+            }
+        }
+        else {
+            std::uninitialized_value_construct_n(first, count);
+        }
+    }
+
+    // Сдвигает перекрывающийся диапазон [first, last) влево на позицию dest
+    static void ShiftLeft(Type* first, Type* last, Type* dest) {
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            if (first != last) {
+                std::memmove(static_cast<void*>(dest), first,
+                             static_cast<size_t>(last - first) * sizeof(Type));
+            }
+        }
+        else {
+            std::move(first, last, dest);
+        }
+    }
+
+    // Сдвигает перекрывающийся диапазон [first, last) вправо, конец — в d_last
+    static void ShiftRight(Type* first, Type* last, Type* d_last) {
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            if (first != last) {
+                std::memmove(static_cast<void*>(d_last - (last - first)), first,
+                             static_cast<size_t>(last - first) * sizeof(Type));
+            }
+        }
+        else {
+            std::move_backward(first, last, d_last);
+        }
+    }
+
+    std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+    RawArrayPtr<Type> items_;
     size_t size_ = 0;
     size_t capacity_ = 0;
+    double growth_factor_ = 2.0;
+    double shrink_threshold_ = 0.0;
+#ifdef SIMPLE_VECTOR_PROFILE
+    SimpleVectorStats stats_;
+#endif
 };
 
 template <typename Type>
 inline bool operator==(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    return (lhs.GetSize() == rhs.GetSize()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+    // Для типов без padding-байт равенство значений — это равенство байт
+    if constexpr (std::has_unique_object_representations_v<Type>) {
+        return lhs.GetSize() == 0
+            || std::memcmp(lhs.begin(), rhs.begin(), lhs.GetSize() * sizeof(Type)) == 0;
+    }
+    else {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
 }
 
 template <typename Type>
@@ -332,22 +1050,44 @@ inline bool operator!=(const SimpleVector<Type>& lhs, const SimpleVector<Type>&
     return !(lhs == rhs);
 }
 
+// Трёхстороннее сравнение одним слитым проходом: сортировка больших
+// коллекций ключей делает один скан на сравнение вместо двух.
+// Возвращает отрицательное число, ноль или положительное число
+template <typename Type>
+inline int ThreeWayCompare(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
+    return lhs.Compare(rhs);
+}
+
+#if defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907L
+// В C++20 тот же проход доступен как operator<=>. Порядок слабый:
+// Compare различает элементы только через operator<
+template <typename Type>
+inline std::weak_ordering operator<=>(const SimpleVector<Type>& lhs,
+                                      const SimpleVector<Type>& rhs) {
+    int cmp = lhs.Compare(rhs);
+    return cmp < 0 ? std::weak_ordering::less
+                   : (0 < cmp ? std::weak_ordering::greater : std::weak_ordering::equivalent);
+}
+#endif
+
+// Все отношения порядка выражены через один проход Compare,
+// чтобы не сканировать векторы дважды, как это делало (lhs == rhs) || (lhs < rhs)
 template <typename Type>
 inline bool operator<(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    return lhs.Compare(rhs) < 0;
 }
 
 template <typename Type>
 inline bool operator<=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    return (lhs == rhs) || (lhs < rhs);
+    return lhs.Compare(rhs) <= 0;
 }
 
 template <typename Type>
 inline bool operator>(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    return rhs < lhs;
+    return lhs.Compare(rhs) > 0;
 }
 
 template <typename Type>
 inline bool operator>=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    return (lhs == rhs) || (rhs < lhs);
+    return lhs.Compare(rhs) >= 0;
 }
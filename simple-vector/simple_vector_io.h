@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+#include <unistd.h>
+
+#include "simple_vector.h"
+
+// Потоковая сериализация SimpleVector: заголовок с числом элементов плюс
+// один непрерывный блок байтов вместо тысяч поэлементных write().
+// Для тривиально копируемых типов элементы пишутся прямо из хранилища
+// вектора; для остальных — через пользовательский кодек с внутренним
+// байтовым буфером, так что системных вызовов всё равно единицы
+
+// Размер внутреннего буфера кодека: записи копятся и сбрасываются блоками
+inline constexpr size_t kSimpleVectorIoBatchBytes = 64 * 1024;
+
+// Пишет в fd ровно count байт, повторяя вызов при частичной записи
+inline void WriteExactly(int fd, const void* data, size_t count) {
+    const char* cursor = static_cast<const char*>(data);
+    while (count != 0) {
+        ssize_t written = ::write(fd, cursor, count);
+        if (written <= 0) {
+            throw std::runtime_error("WriteTo: write failed");
+        }
+        cursor += written;
+        count -= static_cast<size_t>(written);
+    }
+}
+
+// Читает из fd ровно count байт, повторяя вызов при частичном чтении
+inline void ReadExactly(int fd, void* data, size_t count) {
+    char* cursor = static_cast<char*>(data);
+    while (count != 0) {
+        ssize_t read_bytes = ::read(fd, cursor, count);
+        if (read_bytes <= 0) {
+            throw std::runtime_error("ReadFrom: read failed");
+        }
+        cursor += read_bytes;
+        count -= static_cast<size_t>(read_bytes);
+    }
+}
+
+// Записывает вектор в fd: заголовок size_ и один непрерывный блок элементов
+template <typename Type>
+void WriteTo(const SimpleVector<Type>& vector, int fd) {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "WriteTo without a codec requires a trivially copyable element type");
+    uint64_t size = vector.GetSize();
+    WriteExactly(fd, &size, sizeof(size));
+    if (size != 0) {
+        WriteExactly(fd, vector.begin(), size * sizeof(Type));
+    }
+}
+
+// Записывает вектор в поток: заголовок size_ и один непрерывный блок элементов
+template <typename Type>
+void WriteTo(const SimpleVector<Type>& vector, std::ostream& out) {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "WriteTo without a codec requires a trivially copyable element type");
+    uint64_t size = vector.GetSize();
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    if (size != 0) {
+        out.write(reinterpret_cast<const char*>(vector.begin()),
+                  static_cast<std::streamsize>(size * sizeof(Type)));
+    }
+    if (!out) {
+        throw std::runtime_error("WriteTo: stream write failed");
+    }
+}
+
+// Читает вектор, записанный WriteTo, одним непрерывным чтением
+template <typename Type>
+SimpleVector<Type> ReadFrom(int fd) {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "ReadFrom without a codec requires a trivially copyable element type");
+    uint64_t size = 0;
+    ReadExactly(fd, &size, sizeof(size));
+    SimpleVector<Type> result;
+    result.ResizeUninitialized(size);
+    if (size != 0) {
+        ReadExactly(fd, result.begin(), size * sizeof(Type));
+    }
+    return result;
+}
+
+template <typename Type>
+SimpleVector<Type> ReadFrom(std::istream& in) {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "ReadFrom without a codec requires a trivially copyable element type");
+    uint64_t size = 0;
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));
+    SimpleVector<Type> result;
+    result.ResizeUninitialized(size);
+    if (size != 0) {
+        in.read(reinterpret_cast<char*>(result.begin()),
+                static_cast<std::streamsize>(size * sizeof(Type)));
+    }
+    if (!in) {
+        throw std::runtime_error("ReadFrom: stream read failed");
+    }
+    return result;
+}
+
+// Записывает вектор нетривиального типа: encode(элемент, байтовый буфер)
+// дописывает сериализованные байты в буфер, буфер сбрасывается в поток
+// блоками по kSimpleVectorIoBatchBytes. Формат: число элементов,
+// суммарный размер полезной нагрузки, затем сама нагрузка
+template <typename Type, typename Encoder>
+void WriteTo(const SimpleVector<Type>& vector, std::ostream& out, Encoder encode) {
+    SimpleVector<unsigned char> payload;
+    uint64_t payload_bytes = 0;
+    for (const Type& value : vector) {
+        encode(value, payload);
+    }
+    payload_bytes = payload.GetSize();
+
+    uint64_t size = vector.GetSize();
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    out.write(reinterpret_cast<const char*>(&payload_bytes), sizeof(payload_bytes));
+    // Нагрузка уже непрерывна — уходит блоками батчевого размера
+    for (size_t from = 0; from < payload.GetSize(); from += kSimpleVectorIoBatchBytes) {
+        size_t count = std::min(kSimpleVectorIoBatchBytes, payload.GetSize() - from);
+        out.write(reinterpret_cast<const char*>(payload.begin() + from),
+                  static_cast<std::streamsize>(count));
+    }
+    if (!out) {
+        throw std::runtime_error("WriteTo: stream write failed");
+    }
+}
+
+// Читает вектор, записанный WriteTo с кодеком. Нагрузка читается одним
+// блоком, затем decode(курсор, конец) восстанавливает элементы по одному,
+// продвигая курсор на прочитанные байты
+template <typename Type, typename Decoder>
+SimpleVector<Type> ReadFrom(std::istream& in, Decoder decode) {
+    uint64_t size = 0;
+    uint64_t payload_bytes = 0;
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));
+    in.read(reinterpret_cast<char*>(&payload_bytes), sizeof(payload_bytes));
+
+    SimpleVector<unsigned char> payload;
+    payload.ResizeUninitialized(payload_bytes);
+    in.read(reinterpret_cast<char*>(payload.begin()),
+            static_cast<std::streamsize>(payload_bytes));
+    if (!in) {
+        throw std::runtime_error("ReadFrom: stream read failed");
+    }
+
+    SimpleVector<Type> result;
+    result.Reserve(size);
+    const unsigned char* cursor = payload.begin();
+    const unsigned char* payload_end = payload.end();
+    for (uint64_t i = 0; i < size; ++i) {
+        result.PushBack(decode(cursor, payload_end));
+    }
+    if (cursor != payload_end) {
+        throw std::runtime_error("ReadFrom: payload size mismatch");
+    }
+    return result;
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "simple_vector.h"
+
+// Формат снимка на диске: заголовок + сырые элементы подряд.
+// Читается обратно без десериализации — файл просто отображается в память
+struct SimpleVectorFileHeader {
+    static constexpr uint64_t kMagic = 0x3130'5041'4e53'5653ull;  // "SVSNAP01"
+
+    uint64_t magic = kMagic;
+    // Контроль совместимости типа: размер и выравнивание элемента.
+    // Полноценного хэша типа в C++ нет, но несовпадение размеров ловит
+    // подавляющее большинство ошибок чтения чужим типом
+    uint64_t element_size = 0;
+    uint64_t element_align = 0;
+    uint64_t size = 0;
+};
+
+// Записывает снимок вектора в файл path в формате SimpleVectorFileHeader.
+// Только для тривиально копируемых типов — элементы пишутся одним блоком
+template <typename Type>
+void SaveToFile(const SimpleVector<Type>& vector, const std::string& path) {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "SaveToFile requires a trivially copyable element type");
+
+    int fd = ::open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("SaveToFile: cannot open " + path);
+    }
+
+    SimpleVectorFileHeader header;
+    header.element_size = sizeof(Type);
+    header.element_align = alignof(Type);
+    header.size = vector.GetSize();
+
+    bool ok = ::write(fd, &header, sizeof(header)) == static_cast<ssize_t>(sizeof(header));
+    if (ok && vector.GetSize() != 0) {
+        auto bytes = static_cast<ssize_t>(vector.GetSize() * sizeof(Type));
+        ok = ::write(fd, vector.begin(), bytes) == bytes;
+    }
+    ::close(fd);
+    if (!ok) {
+        throw std::runtime_error("SaveToFile: short write to " + path);
+    }
+}
+
+// Читающее представление снимка SimpleVector поверх mmap: файл отображается
+// в память целиком, страницы подгружаются лениво при первом обращении.
+// Повторяет читающую часть интерфейса SimpleVector (begin/end, At, [])
+template <typename Type>
+class SimpleVectorView {
+public:
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "SimpleVectorView requires a trivially copyable element type");
+
+    using ConstIterator = const Type*;
+
+    // Отображает файл path; бросает std::runtime_error, если файл
+    // не открывается или записан для другого типа элементов
+    explicit SimpleVectorView(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("SimpleVectorView: cannot open " + path);
+        }
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SimpleVectorFileHeader)) {
+            ::close(fd);
+            throw std::runtime_error("SimpleVectorView: bad file " + path);
+        }
+        mapped_bytes_ = static_cast<size_t>(st.st_size);
+
+        void* mapped = ::mmap(nullptr, mapped_bytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            throw std::runtime_error("SimpleVectorView: mmap failed for " + path);
+        }
+        mapped_ = mapped;
+
+        SimpleVectorFileHeader header;
+        std::memcpy(&header, mapped_, sizeof(header));
+        if (header.magic != SimpleVectorFileHeader::kMagic
+            || header.element_size != sizeof(Type)
+            || header.element_align != alignof(Type)
+            || mapped_bytes_ < sizeof(header) + header.size * sizeof(Type)) {
+            ::munmap(mapped_, mapped_bytes_);
+            throw std::runtime_error("SimpleVectorView: wrong format in " + path);
+        }
+
+        items_ = reinterpret_cast<const Type*>(static_cast<const char*>(mapped_) + sizeof(header));
+        size_ = header.size;
+    }
+
+    SimpleVectorView(SimpleVectorView&& other) noexcept {
+        mapped_ = std::exchange(other.mapped_, nullptr);
+        mapped_bytes_ = std::exchange(other.mapped_bytes_, 0);
+        items_ = std::exchange(other.items_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    // Запрещаем копирование: отображением владеет один объект
+    SimpleVectorView(const SimpleVectorView&) = delete;
+    SimpleVectorView& operator=(const SimpleVectorView&) = delete;
+    SimpleVectorView& operator=(SimpleVectorView&&) = delete;
+
+    ~SimpleVectorView() {
+        if (mapped_ != nullptr) {
+            ::munmap(mapped_, mapped_bytes_);
+        }
+    }
+
+    // Возвращает количество элементов в снимке
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустой ли снимок
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает константную ссылку на элемент с индексом index
+    const Type& operator[](size_t index) const noexcept {
+        return items_[index];
+    }
+
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return items_[index];
+    }
+
+    ConstIterator begin() const noexcept {
+        return items_;
+    }
+
+    ConstIterator end() const noexcept {
+        return items_ + size_;
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    void* mapped_ = nullptr;
+    size_t mapped_bytes_ = 0;
+    const Type* items_ = nullptr;
+    size_t size_ = 0;
+};
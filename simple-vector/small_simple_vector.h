@@ -0,0 +1,258 @@
+#pragma once
+
+#include <cassert>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "array_ptr.h"
+
+// Вектор с малым буфером (SBO): до N элементов хранятся прямо внутри объекта,
+// без обращения к куче. Куча (RawArrayPtr) подключается только когда элементов
+// становится больше N. Интерфейс повторяет SimpleVector
+template <typename Type, size_t N>
+class SmallSimpleVector {
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    SmallSimpleVector() noexcept = default;
+
+    // Создаёт вектор из size элементов, инициализированных значением по умолчанию
+    explicit SmallSimpleVector(size_t size) {
+        ReserveForGrowth(size);
+        std::uninitialized_value_construct_n(Data(), size);
+        size_ = size;
+    }
+
+    // Создаёт вектор из size элементов, инициализированных значением value
+    SmallSimpleVector(size_t size, const Type& value) {
+        ReserveForGrowth(size);
+        std::uninitialized_fill_n(Data(), size, value);
+        size_ = size;
+    }
+
+    SmallSimpleVector(const SmallSimpleVector& other) {
+        ReserveForGrowth(other.size_);
+        std::uninitialized_copy(other.begin(), other.end(), Data());
+        size_ = other.size_;
+    }
+
+    // Перемещение: хранилище в куче забирается указателем,
+    // инлайн-элементы переносятся поштучно
+    SmallSimpleVector(SmallSimpleVector&& other) {
+        if (other.IsInline()) {
+            std::uninitialized_move(other.begin(), other.end(), Data());
+            size_ = other.size_;
+            other.Clear();
+        }
+        else {
+            heap_ = std::move(other.heap_);
+            size_ = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, N);
+        }
+    }
+
+    SmallSimpleVector& operator=(const SmallSimpleVector& rhs) {
+        if (this != &rhs) {
+            SmallSimpleVector tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    SmallSimpleVector& operator=(SmallSimpleVector&& rhs) {
+        if (this != &rhs) {
+            std::destroy(begin(), end());
+            size_ = 0;
+            if (rhs.IsInline()) {
+                std::uninitialized_move(rhs.begin(), rhs.end(), Data());
+                size_ = rhs.size_;
+                rhs.Clear();
+            }
+            else {
+                heap_ = std::move(rhs.heap_);
+                size_ = std::exchange(rhs.size_, 0);
+                capacity_ = std::exchange(rhs.capacity_, N);
+            }
+        }
+        return *this;
+    }
+
+    ~SmallSimpleVector() {
+        std::destroy(begin(), end());
+    }
+
+    // Возвращает количество элементов в массиве
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Возвращает вместимость массива (не меньше N)
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    // Сообщает, пустой ли массив
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Сообщает, лежат ли элементы во встроенном буфере
+    bool IsInline() const noexcept {
+        return !heap_;
+    }
+
+    // Возвращает ссылку на элемент с индексом index
+    Type& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    Type& At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return Data()[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Error: no index");
+        }
+        return Data()[index];
+    }
+
+    // Обнуляет размер массива, не изменяя его вместимость
+    void Clear() noexcept {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    // Добавляет элемент в конец вектора
+    void PushBack(const Type& item) {
+        if (size_ == capacity_) {
+            Grow(size_ + 1);
+        }
+        new (Data() + size_) Type(item);
+        ++size_;
+    }
+
+    void PushBack(Type&& item) {
+        if (size_ == capacity_) {
+            Grow(size_ + 1);
+        }
+        new (Data() + size_) Type(std::move(item));
+        ++size_;
+    }
+
+    // Конструирует элемент в конце вектора прямо в хранилище из args
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        if (size_ == capacity_) {
+            Grow(size_ + 1);
+        }
+        new (Data() + size_) Type(std::forward<Args>(args)...);
+        ++size_;
+        return Data()[size_ - 1];
+    }
+
+    // "Удаляет" последний элемент вектора. Вектор не должен быть пустым
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+        std::destroy_at(Data() + size_ - 1);
+        --size_;
+    }
+
+    // Изменяет размер массива.
+    // При увеличении размера новые элементы получают значение по умолчанию
+    void Resize(size_t new_size) {
+        if (new_size < size_) {
+            std::destroy(Data() + new_size, Data() + size_);
+        }
+        else if (new_size > size_) {
+            if (new_size > capacity_) {
+                Grow(new_size);
+            }
+            std::uninitialized_value_construct(Data() + size_, Data() + new_size);
+        }
+        size_ = new_size;
+    }
+
+    Iterator begin() noexcept {
+        return Data();
+    }
+
+    Iterator end() noexcept {
+        return Data() + size_;
+    }
+
+    ConstIterator begin() const noexcept {
+        return Data();
+    }
+
+    ConstIterator end() const noexcept {
+        return Data() + size_;
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    // Обменивает значение с другим вектором.
+    // Если оба вектора в куче — обмен указателями, иначе элементы переносятся
+    void swap(SmallSimpleVector& other) {
+        if (!IsInline() && !other.IsInline()) {
+            heap_.swap(other.heap_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+            return;
+        }
+        SmallSimpleVector tmp(std::move(*this));
+        *this = std::move(other);
+        other = std::move(tmp);
+    }
+
+private:
+    Type* Data() noexcept {
+        return heap_ ? heap_.Get() : reinterpret_cast<Type*>(inline_buf_);
+    }
+
+    const Type* Data() const noexcept {
+        return heap_ ? heap_.Get() : reinterpret_cast<const Type*>(inline_buf_);
+    }
+
+    // Выделяет кучу заранее, если элементы заведомо не влезут в инлайн-буфер
+    void ReserveForGrowth(size_t required) {
+        if (required > capacity_) {
+            heap_ = RawArrayPtr<Type>(required);
+            capacity_ = required;
+        }
+    }
+
+    // Переносит элементы в новый блок в куче вместимостью не меньше required
+    void Grow(size_t required) {
+        size_t new_capacity = std::max(required, 2 * capacity_);
+        RawArrayPtr<Type> new_heap(new_capacity);
+        std::uninitialized_move(begin(), end(), new_heap.Get());
+        std::destroy(begin(), end());
+        heap_ = std::move(new_heap);
+        capacity_ = new_capacity;
+    }
+
+    alignas(Type) unsigned char inline_buf_[N * sizeof(Type)];
+    RawArrayPtr<Type> heap_;
+    size_t size_ = 0;
+    size_t capacity_ = N;
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <tuple>
+#include <utility>
+
+#include "simple_vector.h"
+
+// Колоночный (structure-of-arrays) напарник SimpleVector: каждое поле
+// записи хранится в собственном SimpleVector, поэтому скан по одному-двум
+// полям читает плотный непрерывный поток и не тащит в кэш остальные байты
+// записи. Для 96-байтной записи, у которой горячие только два 8-байтных
+// поля, это на порядок меньше кэш-линий на элемент, и цикл по колонке
+// векторизуется как обычный массив.
+//
+// API повторяет SimpleVector там, где это имеет смысл для колонок:
+// PushBack принимает значения всех полей, operator[] возвращает кортеж
+// ссылок, Column<I>() даёт саму колонку — с её begin()/end() для сканов
+template <typename... Fields>
+class SimpleSoAVector {
+public:
+    static constexpr size_t kColumnCount = sizeof...(Fields);
+    static_assert(kColumnCount > 0, "SimpleSoAVector requires at least one field");
+
+    // Кортежи ссылок на поля одной логической записи
+    using Reference = std::tuple<Fields&...>;
+    using ConstReference = std::tuple<const Fields&...>;
+
+    SimpleSoAVector() = default;
+
+    // Создаёт size записей со значениями полей по умолчанию
+    explicit SimpleSoAVector(size_t size)
+        : columns_(SimpleVector<Fields>(size)...) {
+    }
+
+    // Все колонки выделяют память у ресурса resource
+    explicit SimpleSoAVector(std::pmr::memory_resource* resource)
+        : columns_(SimpleVector<Fields>(resource)...) {
+    }
+
+    // Возвращает количество записей
+    size_t GetSize() const noexcept {
+        return std::get<0>(columns_).GetSize();
+    }
+
+    // Возвращает вместимость (одинакова у всех колонок)
+    size_t GetCapacity() const noexcept {
+        return std::get<0>(columns_).GetCapacity();
+    }
+
+    // Сообщает, пустой ли контейнер
+    bool IsEmpty() const noexcept {
+        return std::get<0>(columns_).IsEmpty();
+    }
+
+    // Добавляет запись: по одному значению на каждую колонку.
+    // Если вставка в какую-то колонку бросила, уже вставленные
+    // значения откатываются — колонки не расходятся по длине
+    void PushBack(Fields... values) {
+        PushBackImpl(std::index_sequence_for<Fields...>{}, std::move(values)...);
+    }
+
+    // Удаляет последнюю запись. Контейнер не должен быть пустым
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+        std::apply([](auto&... columns) {
+            (columns.PopBack(), ...);
+        }, columns_);
+    }
+
+    // Изменяет число записей во всех колонках
+    void Resize(size_t new_size) {
+        std::apply([new_size](auto&... columns) {
+            (columns.Resize(new_size), ...);
+        }, columns_);
+    }
+
+    // Резервирует вместимость во всех колонках
+    void Reserve(size_t new_capacity) {
+        std::apply([new_capacity](auto&... columns) {
+            (columns.Reserve(new_capacity), ...);
+        }, columns_);
+    }
+
+    // Обнуляет число записей, не меняя вместимость
+    void Clear() noexcept {
+        std::apply([](auto&... columns) {
+            (columns.Clear(), ...);
+        }, columns_);
+    }
+
+    // Возвращает кортеж ссылок на поля записи с индексом index
+    Reference operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        return std::apply([index](auto&... columns) {
+            return Reference(columns[index]...);
+        }, columns_);
+    }
+
+    ConstReference operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return std::apply([index](const auto&... columns) {
+            return ConstReference(columns[index]...);
+        }, columns_);
+    }
+
+    // Возвращает колонку с номером I — плотный SimpleVector одного поля.
+    // Горячие сканы идут по Column<I>().begin()/end()
+    template <size_t I>
+    auto& Column() noexcept {
+        return std::get<I>(columns_);
+    }
+
+    template <size_t I>
+    const auto& Column() const noexcept {
+        return std::get<I>(columns_);
+    }
+
+private:
+    template <size_t... I, typename... Args>
+    void PushBackImpl(std::index_sequence<I...>, Args&&... args) {
+        size_t pushed = 0;
+        try {
+            ((std::get<I>(columns_).PushBack(std::forward<Args>(args)), ++pushed), ...);
+        }
+        catch (...) {
+            // Снимаем значения с колонок, куда вставка уже прошла
+            size_t column = 0;
+            ((column++ < pushed ? std::get<I>(columns_).PopBack() : void()), ...);
+            throw;
+        }
+    }
+
+    std::tuple<SimpleVector<Fields>...> columns_;
+};
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
+#include "simple_vector.h"
+
+// Сортированный индекс поверх SimpleVector: элементы всегда упорядочены,
+// Insert ставит значение на место через lower_bound и существующую вставку
+// вектора, LowerBound/Contains дают двоичный поиск без ручного
+// std::lower_bound на каждом месте вызова.
+//
+// Для горячего пути проб есть альтернативная раскладка Эйценгера
+// (BuildEytzinger): элементы переупорядочиваются как неявное дерево
+// поиска в ширину — потомки узла k лежат в 2k и 2k+1. Спуск по такому
+// дереву не ветвится по результату сравнения (индекс считается
+// арифметикой) и префетчит правнуков, пряча цепочку кэш-промахов,
+// из которой состоит классический двоичный поиск. Любая мутация
+// сбрасывает раскладку — индекс строится один раз и пробится много.
+// Для раскладки тип должен иметь конструктор по умолчанию
+template <typename Type>
+class SortedSimpleVector {
+public:
+    using ConstIterator = typename SimpleVector<Type>::ConstIterator;
+
+    SortedSimpleVector() = default;
+
+    // Хранилище выделяется у ресурса resource
+    explicit SortedSimpleVector(std::pmr::memory_resource* resource)
+        : items_(resource), eytzinger_(resource) {
+    }
+
+    // Возвращает количество элементов
+    size_t GetSize() const noexcept {
+        return items_.GetSize();
+    }
+
+    // Сообщает, пустой ли индекс
+    bool IsEmpty() const noexcept {
+        return items_.IsEmpty();
+    }
+
+    // Возвращает константную ссылку на элемент с индексом index.
+    // Мутирующего operator[] нет — он позволил бы сломать порядок
+    const Type& operator[](size_t index) const noexcept {
+        return items_[index];
+    }
+
+    // Резервирует вместимость хранилища
+    void Reserve(size_t new_capacity) {
+        items_.Reserve(new_capacity);
+    }
+
+    // Вставляет значение на сортированную позицию.
+    // Возвращает итератор на вставленный элемент
+    ConstIterator Insert(const Type& value) {
+        InvalidateEytzinger();
+        auto pos = std::lower_bound(items_.begin(), items_.end(), value);
+        return items_.Insert(static_cast<ConstIterator>(pos), value);
+    }
+
+    ConstIterator Insert(Type&& value) {
+        InvalidateEytzinger();
+        auto pos = std::lower_bound(items_.begin(), items_.end(), value);
+        return items_.Insert(static_cast<ConstIterator>(pos), std::move(value));
+    }
+
+    // Удаляет элемент в позиции pos
+    ConstIterator Erase(ConstIterator pos) {
+        InvalidateEytzinger();
+        return items_.Erase(pos);
+    }
+
+    // Возвращает итератор на первый элемент, не меньший value
+    ConstIterator LowerBound(const Type& value) const {
+        return std::lower_bound(items_.begin(), items_.end(), value);
+    }
+
+    // Проверяет наличие значения. При построенной раскладке Эйценгера
+    // проба идёт по ней — без ветвлений и с префетчем
+    bool Contains(const Type& value) const {
+        if (HasEytzingerLayout()) {
+            const Type* found = EytzingerLowerBound(value);
+            return found != nullptr && !(value < *found);
+        }
+        auto pos = LowerBound(value);
+        return pos != items_.end() && !(value < *pos);
+    }
+
+    // Строит раскладку Эйценгера по текущему содержимому.
+    // Вызывается после заполнения индекса, перед фазой проб
+    void BuildEytzinger() {
+        eytzinger_.Resize(items_.GetSize() + 1);  // ячейка 0 не используется
+        size_t cursor = 0;
+        FillEytzinger(cursor, 1);
+    }
+
+    // Сообщает, актуальна ли раскладка Эйценгера
+    bool HasEytzingerLayout() const noexcept {
+        return !items_.IsEmpty() && eytzinger_.GetSize() == items_.GetSize() + 1;
+    }
+
+    // Возвращает адрес наименьшего элемента, не меньшего value,
+    // в раскладке Эйценгера; nullptr, если все элементы меньше value.
+    // Спуск не ветвится по результату сравнения: следующий индекс
+    // вычисляется как 2k или 2k+1 одной арифметической операцией
+    const Type* EytzingerLowerBound(const Type& value) const {
+        assert(HasEytzingerLayout());
+        size_t count = items_.GetSize();
+        size_t k = 1;
+        while (k <= count) {
+            // Префетч правнуков: они понадобятся через две итерации
+            if (k * kPrefetchStride <= count) {
+                __builtin_prefetch(&eytzinger_[k * kPrefetchStride]);
+            }
+            k = 2 * k + static_cast<size_t>(eytzinger_[k] < value);
+        }
+        // Откат к последнему повороту влево восстанавливает lower bound
+        k >>= static_cast<size_t>(__builtin_ffsll(static_cast<long long>(~k)));
+        return k == 0 ? nullptr : &eytzinger_[k];
+    }
+
+    ConstIterator begin() const noexcept {
+        return items_.begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return items_.end();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return items_.cbegin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return items_.cend();
+    }
+
+private:
+    // Глубина префетча: правнуки узлов текущего уровня
+    static constexpr size_t kPrefetchStride = 16;
+
+    // Обход сортированного массива слева направо раскладывает его
+    // по узлам неявного дерева в порядке BFS-нумерации
+    void FillEytzinger(size_t& cursor, size_t k) {
+        if (k > items_.GetSize()) {
+            return;
+        }
+        FillEytzinger(cursor, 2 * k);
+        eytzinger_[k] = items_[cursor];
+        ++cursor;
+        FillEytzinger(cursor, 2 * k + 1);
+    }
+
+    void InvalidateEytzinger() noexcept {
+        eytzinger_.Clear();
+    }
+
+    SimpleVector<Type> items_;
+    SimpleVector<Type> eytzinger_;
+};